@@ -17,13 +17,14 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  WorkspaceScope ws;
+  real4d mx    = ws.get("mx"   , nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get("mn"   , nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get("uuu"  , nzm,1,nx+5,ncrms);
+  real4d www   = ws.get("www"  , nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get("iadz" , nzm,ncrms);
+  real2d irho  = ws.get("irho" , nzm,ncrms);
+  real2d irhow = ws.get("irhow", nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -212,13 +213,14 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  WorkspaceScope ws;
+  real4d mx    = ws.get("mx"   , nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get("mn"   , nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get("uuu"  , nzm,1,nx+5,ncrms);
+  real4d www   = ws.get("www"  , nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get("iadz" , nzm,ncrms);
+  real2d irho  = ws.get("irho" , nzm,ncrms);
+  real2d irhow = ws.get("irhow", nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -408,13 +410,14 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  WorkspaceScope ws;
+  real4d mx    = ws.get("mx"   , nzm,1,nx+2,ncrms);
+  real4d mn    = ws.get("mn"   , nzm,1,nx+2,ncrms);
+  real4d uuu   = ws.get("uuu"  , nzm,1,nx+5,ncrms);
+  real4d www   = ws.get("www"  , nz,1,nx+4,ncrms);
+  real2d iadz  = ws.get("iadz" , nzm,ncrms);
+  real2d irho  = ws.get("irho" , nzm,ncrms);
+  real2d irhow = ws.get("irhow", nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
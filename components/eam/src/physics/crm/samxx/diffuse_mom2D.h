@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "workspace.h"
 
 void diffuse_mom2D(real5d &tk);
 
@@ -3,6 +3,7 @@
 
 #include "samxx_const.h"
 #include "vars.h"
+#include "workspace.h"
 
 #include "diffuse_scalar2D.h"
 #include "diffuse_scalar3D.h"
@@ -4,6 +4,8 @@
 #include "samxx_const.h"
 #include "YAKL_fft.h"
 #include "vars.h"
+#include "workspace.h"
+#include "pressure_solver.h"
 #include "press_rhs.h"
 #include "press_grad.h"
 
@@ -12,3 +14,5 @@ extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc,
 
 void pressure();
 
+void pressure_solve_legacy(real4d &f);
+
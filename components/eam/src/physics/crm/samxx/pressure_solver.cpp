@@ -0,0 +1,105 @@
+
+#include "pressure_solver.h"
+
+PressureSolver pressure_solver;
+
+// The solver transforms whole vertical columns, which is only valid when the
+// pressure solve is not split into vertical slabs across subdomains
+static_assert( nsubdomains == 1 , "PressureSolver requires nsubdomains == 1" );
+
+
+void PressureSolver::init_eigenvalues() {
+  YAKL_SCOPE( dx , :: dx );
+  YAKL_SCOPE( dy , :: dy );
+
+  int nypp = RUN2D ? 1 : ny+2;
+
+  this->eign = real2d("eign",nypp,nx+1);
+  YAKL_SCOPE( eign , this->eign );
+
+  // for (int j=0; j<nypp; j++) {
+  //   for (int i=0; i<nx+1; i++) {
+  parallel_for( SimpleBounds<2>(nypp,nx+1) , YAKL_LAMBDA (int j, int i) {
+    real ddx2=1.0/(dx*dx);
+    real ddy2=1.0/(dy*dy);
+    real pii = 3.14159265358979323846;
+    real xnx=pii/nx;
+    real xny=pii/ny;
+    int jd=((j+1)-0.1)/2.0;
+    int id=((i+1)-0.1)/2.0;
+    real xj=jd;
+    real xi=id;
+    eign(j,i)=(2.0*cos(2.0*xnx*xi)-2.0)*ddx2+(2.0*cos(2.0*xny*xj)-2.0)*ddy2;
+  });
+
+  eign_dx = dx;
+  eign_dy = dy;
+}
+
+
+void PressureSolver::solve(real4d &f) {
+  YAKL_SCOPE( rhow  , :: rhow );
+  YAKL_SCOPE( rho   , :: rho );
+  YAKL_SCOPE( adz   , :: adz );
+  YAKL_SCOPE( adzw  , :: adzw );
+  YAKL_SCOPE( dz    , :: dz );
+  YAKL_SCOPE( ncrms , :: ncrms );
+
+  if (! eign.initialized() || eign_dx != ::dx || eign_dy != ::dy) { init_eigenvalues(); }
+  YAKL_SCOPE( eign , this->eign );
+
+  int nypp = RUN2D ? 1 : ny+2;
+
+  fftx.forward_real(f, 2, nx);
+  if (RUN3D) { ffty.forward_real(f, 1, ny); }
+
+  // for (int j=0; j<nypp; j++) {
+  //  for (int i=0; i<nx+1; i++) {
+  //    for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<3>(nypp,nx+1,ncrms) , YAKL_LAMBDA (int j, int i, int icrm) {
+    SArray<real,1,nzm-1> alfa;
+    SArray<real,1,nzm-1> beta;
+
+    int jd=((j+1)-0.1)/2.0;
+    int id=((i+1)-0.1)/2.0;
+    real eig = eign(j,i);
+
+    real a=rhow(0,icrm)/(adz(0,icrm)*adzw(0,icrm)*dz(icrm)*dz(icrm));
+    real c=rhow(1,icrm)/(adz(0,icrm)*adzw(1,icrm)*dz(icrm)*dz(icrm));
+    real b;
+    if(id+jd == 0) {
+      b=1.0/(eig*rho(0,icrm)-a-c);
+    } else {
+      b=1.0/(eig*rho(0,icrm)-c);
+    }
+    alfa(0)=-c*b;
+    beta(0)=f(0,j,i,icrm)*b;
+
+    for(int k=1; k<nzm-1; k++) {
+      a=rhow(k  ,icrm)/(adz(k,icrm)*adzw(k  ,icrm)*dz(icrm)*dz(icrm));
+      c=rhow(k+1,icrm)/(adz(k,icrm)*adzw(k+1,icrm)*dz(icrm)*dz(icrm));
+      real e=1.0/(eig*rho(k,icrm)-a-c+a*alfa(k-1));
+      alfa(k)=-c*e;
+      beta(k)=(f(k,j,i,icrm)-a*beta(k-1))*e;
+    }
+    a=rhow(nzm-1,icrm)/(adz(nzm-1,icrm)*adzw(nzm-1,icrm)*dz(icrm)*dz(icrm));
+    f(nzm-1,j,i,icrm)=(f(nzm-1,j,i,icrm)-a*beta(nzm-2))/
+                      (eig*rho(nzm-1,icrm)-a+a*alfa(nzm-2));
+    for(int k=nzm-2; k>=0; k--) {
+      f(k,j,i,icrm)=alfa(k)*f(k+1,j,i,icrm)+beta(k);
+    }
+  });
+
+  if (RUN3D) { ffty.inverse_real(f); }
+  fftx.inverse_real(f);
+}
+
+
+void PressureSolver::cleanup() {
+  fftx.cleanup();
+  ffty.cleanup();
+  eign = real2d();
+  eign_dx = -1;
+  eign_dy = -1;
+}
+
@@ -103,7 +103,7 @@ printf "3D Defs: $DEFS3D\n\n"
 ############################################################################
 ## CLEAN UP THE PREVIOUS BUILD
 ############################################################################
-rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d
+rm -rf CMakeCache.txt CMakeFiles cmake_install.cmake CTestTestfile.cmake Makefile fortran.exe cpp.exe cpp2d cpp3d fortran2d fortran3d pressure_bench
 
 
 ############################################################################
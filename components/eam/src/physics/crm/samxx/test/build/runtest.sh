@@ -51,3 +51,10 @@ python nccmp.py fortran3d/fortran_output_000001.nc cpp3d/cpp_output_000001.nc ||
 
 ################################################################################
 ################################################################################
+
+printf "\n\nRunning pressure solver benchmarks\n\n"
+./pressure_bench/pressure_bench2d || exit -1
+./pressure_bench/pressure_bench3d || exit -1
+
+################################################################################
+################################################################################
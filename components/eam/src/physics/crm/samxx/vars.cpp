@@ -1,5 +1,6 @@
 
 #include "vars.h"
+#include "pressure_solver.h"
 
 void allocate() {
   t00              = real2d( "t00                "      , nzm, ncrms);
@@ -671,6 +672,7 @@ void finalize() {
 
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
+  pressure_solver.cleanup();
   vt_fftx.cleanup();
   vt_ffty.cleanup();
   esmt_fftx.cleanup();
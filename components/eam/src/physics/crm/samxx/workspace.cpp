@@ -0,0 +1,84 @@
+
+#include "workspace.h"
+
+Workspace crm_workspace;
+
+
+real *Workspace::acquire(size_t nelems) {
+  num_requests++;
+
+  // Best fit among the free buffers that are large enough. Remember the
+  // largest free buffer that is too small so it can be regrown in place,
+  // which keeps the slot count bounded by the number of live temporaries.
+  int ibest  = -1;
+  int ismall = -1;
+  for (int i=0; i<static_cast<int>(slots.size()); i++) {
+    if (slots[i].in_use) continue;
+    if (slots[i].size >= nelems) {
+      if (ibest < 0 || slots[i].size < slots[ibest].size) { ibest = i; }
+    } else {
+      if (ismall < 0 || slots[i].size > slots[ismall].size) { ismall = i; }
+    }
+  }
+
+  if (ibest < 0) {
+    if (ismall >= 0) {
+      ibest = ismall;
+      bytes_reserved -= slots[ibest].size*sizeof(real);
+      slots[ibest].buf = real1d();
+    } else {
+      ibest = static_cast<int>(slots.size());
+      slots.push_back( Slot() );
+    }
+    slots[ibest].buf  = real1d("crm_workspace", nelems);
+    slots[ibest].size = nelems;
+    num_allocations++;
+    bytes_reserved += nelems*sizeof(real);
+  }
+
+  slots[ibest].in_use = true;
+  bytes_in_use += slots[ibest].size*sizeof(real);
+  bytes_high_water = max(bytes_high_water, bytes_in_use);
+  return slots[ibest].buf.data();
+}
+
+
+void Workspace::release(real *ptr) {
+  for (auto &slot : slots) {
+    if (slot.in_use && slot.buf.data() == ptr) {
+      slot.in_use = false;
+      bytes_in_use -= slot.size*sizeof(real);
+      return;
+    }
+  }
+  std::cout << "ERROR: Workspace::release() called on a buffer not owned by the workspace" << std::endl;
+  exit(-1);
+}
+
+
+void Workspace::free_all() {
+  if (bytes_in_use > 0) {
+    std::cout << "ERROR: Workspace::free_all() called while buffers are still in use" << std::endl;
+    exit(-1);
+  }
+  yakl::fence();
+  slots.clear();
+  bytes_reserved = 0;
+}
+
+
+void Workspace::report(std::ostream &os) const {
+  os << "CRM workspace: requests = "           << num_requests
+     << " , allocations = "                    << num_allocations
+     << " , buffers = "                        << slots.size()
+     << " , high-water mark (MB) = "           << std::fixed << std::setprecision(3) << bytes_high_water/1.e6
+     << " , reserved (MB) = "                  << bytes_reserved/1.e6
+     << std::endl;
+}
+
+
+extern "C" void crm_workspace_finalize(bool print_report) {
+  if (print_report) { crm_workspace.report(std::cout); }
+  crm_workspace.free_all();
+}
+
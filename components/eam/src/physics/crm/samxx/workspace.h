@@ -0,0 +1,89 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+// Persistent, size-keyed pool of device buffers for the temporary arrays the
+// CRM routines need inside the subcycle loop. Buffers outlive the routine (and
+// the GCM step) that requested them, so once the pool has grown to its
+// high-water mark a timestep performs no device allocations at all.
+//
+// Buffers are only ever handed out through a WorkspaceScope:
+//
+//   WorkspaceScope ws;
+//   real4d f = ws.get("f", nzslab, ny2, nx2, ncrms);
+//
+// Everything obtained from a scope goes back to the pool when the scope ends.
+// All kernels run in order on a single stream, so a buffer may be reused by
+// the next routine without a fence.
+//////////////////////////////////////////////////////////////////////////////////
+class Workspace {
+public:
+  // Returns a buffer holding at least nelems reals and marks it in use
+  real *acquire(size_t nelems);
+  // Returns a buffer obtained from acquire() to the pool
+  void  release(real *ptr);
+  // Frees all device memory held by the pool (no buffer may be in use)
+  void  free_all();
+  // Prints the allocation counters and the high-water mark
+  void  report(std::ostream &os) const;
+
+  size_t num_requests    = 0; // Number of acquire() calls
+  size_t num_allocations = 0; // Number of device allocations done by the pool
+  size_t bytes_reserved  = 0; // Device memory currently held by the pool
+  size_t bytes_in_use    = 0; // Device memory currently handed out
+  size_t bytes_high_water= 0; // Maximum of bytes_in_use over the run
+
+protected:
+  struct Slot {
+    real1d buf;
+    size_t size;
+    bool   in_use;
+  };
+  std::vector<Slot> slots;
+};
+
+extern Workspace crm_workspace;
+
+
+class WorkspaceScope {
+public:
+  WorkspaceScope() = default;
+  WorkspaceScope(WorkspaceScope const &) = delete;
+  WorkspaceScope &operator=(WorkspaceScope const &) = delete;
+
+  ~WorkspaceScope() {
+    for (auto ptr : taken) { crm_workspace.release(ptr); }
+  }
+
+  real1d get(char const *label, int d0) {
+    return real1d(label, take(d0), d0);
+  }
+  real2d get(char const *label, int d0, int d1) {
+    return real2d(label, take(d0*d1), d0, d1);
+  }
+  real3d get(char const *label, int d0, int d1, int d2) {
+    return real3d(label, take(d0*d1*d2), d0, d1, d2);
+  }
+  real4d get(char const *label, int d0, int d1, int d2, int d3) {
+    return real4d(label, take(d0*d1*d2*d3), d0, d1, d2, d3);
+  }
+  real5d get(char const *label, int d0, int d1, int d2, int d3, int d4) {
+    return real5d(label, take(d0*d1*d2*d3*d4), d0, d1, d2, d3, d4);
+  }
+
+protected:
+  real *take(size_t nelems) {
+    real *ptr = crm_workspace.acquire(nelems);
+    taken.push_back(ptr);
+    return ptr;
+  }
+
+  std::vector<real *> taken;
+};
+
+
+extern "C" void crm_workspace_finalize(bool print_report);
+
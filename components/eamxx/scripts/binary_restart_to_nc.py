@@ -0,0 +1,242 @@
+from utils import expect, ensure_netcdf4
+
+ensure_netcdf4()
+
+from netCDF4 import Dataset
+import numpy as np
+
+import pathlib, struct
+
+###############################################################################
+class BinaryRestartReader(object):
+###############################################################################
+    """
+    Minimal parser for the binary model restart files written by
+    BinaryRestartWriter (see src/share/io/eamxx_binary_restart.hpp).
+    """
+
+    MAGIC   = b"EAMXXRST"
+    TRAILER = b"EAMXXEND"
+    VERSION = 1
+
+    # Must match scream::DataType and binary_restart::GlobalType
+    DATA_TYPES   = {1 : np.int32, 2 : np.float32, 3 : np.float64}
+    GLOBAL_TYPES = {0 : "i", 1 : "q", 2 : "f", 3 : "d"}
+    STRING_TYPE  = 4
+
+    ###########################################################################
+    def __init__(self,filename):
+    ###########################################################################
+        self._filename = filename
+        with open(filename,"rb") as fd:
+            self._buf = fd.read()
+        self._pos = 0
+
+    ###########################################################################
+    def unpack(self,fmt):
+    ###########################################################################
+        size = struct.calcsize(fmt)
+        expect (self._pos+size<=len(self._buf),
+                f"Unexpected end of binary restart file '{self._filename}'.")
+        vals = struct.unpack_from(fmt,self._buf,self._pos)
+        self._pos += size
+        return vals[0] if len(vals)==1 else vals
+
+    ###########################################################################
+    def bytes(self,size):
+    ###########################################################################
+        expect (self._pos+size<=len(self._buf),
+                f"Unexpected end of binary restart file '{self._filename}'.")
+        b = self._buf[self._pos:self._pos+size]
+        self._pos += size
+        return b
+
+    ###########################################################################
+    def string(self):
+    ###########################################################################
+        return self.bytes(self.unpack("=q")).decode()
+
+    ###########################################################################
+    def check_tag(self,tag):
+    ###########################################################################
+        expect (self.bytes(len(tag))==tag,
+                f"Invalid or truncated binary restart file '{self._filename}'.")
+
+    ###########################################################################
+    def read_globals(self):
+    ###########################################################################
+        self.check_tag(self.MAGIC)
+        version = self.unpack("=i")
+        expect (version==self.VERSION,
+                f"Unsupported binary restart file version {version} in '{self._filename}'.")
+        nranks = self.unpack("=i")
+        timestamp = self.string()
+        nsteps = self.unpack("=i")
+        globs = {"nsteps" : np.int32(nsteps)}
+        for _ in range(self.unpack("=i")):
+            name  = self.string()
+            gtype = self.unpack("=i")
+            payload = self.bytes(self.unpack("=q"))
+            if gtype==self.STRING_TYPE:
+                globs[name] = payload.decode()
+            else:
+                expect (gtype in self.GLOBAL_TYPES,
+                        f"Unsupported type for global '{name}' in '{self._filename}'.")
+                globs[name] = struct.unpack("="+self.GLOBAL_TYPES[gtype],payload)[0]
+        self.check_tag(self.TRAILER)
+        return nranks, timestamp, globs
+
+    ###########################################################################
+    def read_rank(self,rank):
+    ###########################################################################
+        self.check_tag(self.MAGIC)
+        version, _, file_rank = self.unpack("=iii")
+        expect (version==self.VERSION and file_rank==rank,
+                f"Binary restart rank file '{self._filename}' is inconsistent with the globals file.")
+        grids = {}
+        for _ in range(self.unpack("=i")):
+            gname = self.string()
+            part_dim_name = self.string()
+            ngids = self.unpack("=i")
+            gids = np.frombuffer(self.bytes(4*ngids),dtype=np.int32)
+            fields = {}
+            for _ in range(self.unpack("=i")):
+                fname = self.string()
+                dtype = self.DATA_TYPES[self.unpack("=i")]
+                dims = []
+                for _ in range(self.unpack("=i")):
+                    dims.append((self.string(),self.unpack("=i")))
+                part_dim = self.unpack("=i")
+                last_extent = self.unpack("=i")
+                nbytes = self.unpack("=q")
+                data = np.frombuffer(self.bytes(nbytes),dtype=dtype)
+                if len(dims)>0:
+                    # Strip padding along the last dimension
+                    shape = [d[1] for d in dims]
+                    data = data.reshape(shape[:-1]+[last_extent])[...,:shape[-1]]
+                else:
+                    data = data[0]
+                fields[fname] = (dims,part_dim,data)
+            grids[gname] = (part_dim_name,gids,fields)
+        self.check_tag(self.TRAILER)
+        return grids
+
+###############################################################################
+class BinaryRestartToNc(object):
+###############################################################################
+
+    ###########################################################################
+    def __init__(self,src_file,tgt_file=None,overwrite=False,geo_file=None):
+    ###########################################################################
+
+        self._src_file = pathlib.Path(src_file).resolve().absolute()
+        expect (self._src_file.exists(),
+                f"Error! File '{self._src_file}' does not exist.")
+        expect (self._src_file.suffix==".bin",
+                f"Error! File '{self._src_file}' does not look like a binary restart file.")
+
+        if tgt_file is None:
+            self._tgt_file = self._src_file.with_suffix(".nc")
+        else:
+            self._tgt_file = pathlib.Path(tgt_file).resolve().absolute()
+        expect (overwrite or not self._tgt_file.exists(),
+                f"Error! File '{self._tgt_file}' already exists. Use --overwrite to replace it.")
+
+        # Binary checkpoints only store the RESTART fields, not the geometry data
+        # (lat, lon, area, hyam, ...) that NetCDF restart files carry
+        if geo_file is None:
+            self._geo_file = None
+        else:
+            self._geo_file = pathlib.Path(geo_file).resolve().absolute()
+            expect (self._geo_file.exists(),
+                    f"Error! File '{self._geo_file}' does not exist.")
+
+    ###########################################################################
+    def run(self):
+    ###########################################################################
+        nranks, timestamp, globs = BinaryRestartReader(str(self._src_file)).read_globals()
+
+        ranks = []
+        for rank in range(nranks):
+            rank_file = f"{self._src_file}.{rank:06d}"
+            expect (pathlib.Path(rank_file).exists(),
+                    f"Error! Rank file '{rank_file}' does not exist.")
+            ranks.append(BinaryRestartReader(rank_file).read_rank(rank))
+
+        ds = Dataset(str(self._tgt_file),"w")
+
+        # Same as a NetCDF model restart: one time slice, global attributes for nsteps and extra data
+        ds.createDimension("time",None)
+        time = ds.createVariable("time","f8",("time",))
+        yy, mm, dd, tod = timestamp.split("-")
+        tod = int(tod)
+        time.units = f"days since {yy}-{mm}-{dd} {tod//3600:02d}:{(tod%3600)//60:02d}:{tod%60:02d}"
+        time[0] = 0.0
+        for name, value in globs.items():
+            ds.setncattr(name,value)
+
+        for gname in ranks[0]:
+            part_dim_name = ranks[0][gname][0]
+
+            # Global index of each rank's partitioned entries
+            all_gids = np.concatenate([r[gname][1] for r in ranks])
+            min_gid = all_gids.min() if all_gids.size>0 else 0
+            nglobal = all_gids.max()-min_gid+1 if all_gids.size>0 else 0
+            expect (np.unique(all_gids).size==all_gids.size==nglobal,
+                    f"Error! Partitioned dim gids of grid '{gname}' are not a contiguous set of unique ids.")
+
+            for fname, (dims, part_dim, _) in ranks[0][gname][2].items():
+                expect (fname not in ds.variables,
+                        f"Error! Field '{fname}' appears on multiple grids.")
+                shape = [d[1] for d in dims]
+                if part_dim>=0:
+                    shape[part_dim] = nglobal
+                names = [d[0] for d in dims]
+                for n,s in zip(names,shape):
+                    if n not in ds.dimensions:
+                        ds.createDimension(n,s)
+                    expect (len(ds.dimensions[n])==s,
+                            f"Error! Dimension '{n}' has inconsistent lengths across fields.")
+
+                data = ranks[0][gname][2][fname][2]
+                if part_dim>=0:
+                    gdata = np.zeros(shape,dtype=data.dtype)
+                    for r in ranks:
+                        idx = [slice(None)]*len(shape)
+                        idx[part_dim] = r[gname][1]-min_gid
+                        gdata[tuple(idx)] = r[gname][2][fname][2]
+                    data = gdata
+
+                var = ds.createVariable(fname,data.dtype,tuple(["time"]+names))
+                var[0,...] = data
+
+        if self._geo_file is not None:
+            self.copy_geo_data(ds)
+
+        ds.close()
+
+        print (f" Converted binary restart file:\n"
+               f"   src file: {self._src_file}\n"
+               f"   tgt file: {self._tgt_file}")
+
+        return True
+
+    ###########################################################################
+    def copy_geo_data(self,ds):
+    ###########################################################################
+        # Copy the time-independent variables of the geo file that are not in the
+        # checkpoint, provided their dimensions are consistent with the checkpoint ones
+        geo = Dataset(str(self._geo_file),"r")
+        for name, src in geo.variables.items():
+            if name in ds.variables or "time" in src.dimensions:
+                continue
+            if any(d in ds.dimensions and len(ds.dimensions[d])!=len(geo.dimensions[d])
+                   for d in src.dimensions):
+                continue
+            for d in src.dimensions:
+                if d not in ds.dimensions:
+                    ds.createDimension(d,len(geo.dimensions[d]))
+            var = ds.createVariable(name,src.datatype,src.dimensions)
+            var.setncatts({a : src.getncattr(a) for a in src.ncattrs()})
+            var[...] = src[...]
+        geo.close()
@@ -7,9 +7,11 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_lincomb.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
+#include "share/util/eamxx_numa_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
@@ -30,6 +32,7 @@
 #include <unistd.h>
 #endif
 
+#include <cstdlib>
 #include <fstream>
 #include <random>
 
@@ -247,7 +250,16 @@ void AtmosphereDriver::create_grids()
     // Restarted run -> read geo data from restart file
     const auto& casename = ic_pl.get<std::string>("restart_casename");
     auto filename = find_filename_in_rpointer (casename,true,m_atm_comm,m_run_t0);
-    gm_params.set("ic_filename", filename);
+    if (binary_restart::is_binary_restart_file(filename)) {
+      // Binary checkpoints only store restart fields, so geo data must come from the IC file
+      EKAT_REQUIRE_MSG (ic_pl.isParameter("Filename"),
+          "Error! Restarting from a binary checkpoint requires initial_conditions::Filename,\n"
+          "       since the grids manager reads geometric data from it.\n"
+          "  - restart file: " + filename + "\n");
+      gm_params.set("ic_filename", ic_pl.get<std::string>("Filename"));
+    } else {
+      gm_params.set("ic_filename", filename);
+    }
     m_atm_params.sublist("provenance").set("initial_conditions_file",filename);
   } else if (ic_pl.isParameter("Filename")) {
     // Initial run, if an IC file is present, pass it.
@@ -693,23 +705,41 @@ void AtmosphereDriver::initialize_output_managers () {
     auto restart_pl = io_params.sublist("model_restart");
     restart_pl.set<std::string>("Averaging Type","Instant");
     restart_pl.sublist("provenance") = m_atm_params.sublist("provenance");
-    auto& om = m_output_managers.emplace_back();
-    if (fvphyshack) {
+    const auto restart_format = restart_pl.get<std::string>("restart_format","netcdf");
+    EKAT_REQUIRE_MSG (restart_format=="netcdf" or restart_format=="binary",
+        "Error! Unsupported model restart format '" + restart_format + "'.\n"
+        "       Valid options: netcdf, binary.\n");
+    if (restart_format=="binary") {
       // Don't save CGLL fields from ICs to the restart file.
       std::map<std::string,field_mgr_ptr> fms;
       for (auto& it : m_field_mgrs) {
-        if (it.first == "Physics GLL") continue;
+        if (fvphyshack and it.first == "Physics GLL") continue;
         fms[it.first] = it.second;
       }
-      om.set_logger(m_atm_logger);
-      om.setup(m_atm_comm,restart_pl,         fms,m_grids_manager,m_run_t0,m_case_t0,true);
+      m_binary_restart_writer = std::make_shared<BinaryRestartWriter>(m_atm_comm,restart_pl,fms,m_run_t0);
+      m_binary_restart_writer->set_logger(m_atm_logger);
+      for (const auto& it : m_atm_process_group->get_restart_extra_data()) {
+        m_binary_restart_writer->add_global(it.first,it.second);
+      }
     } else {
+      auto& om = m_output_managers.emplace_back();
+      if (fvphyshack) {
+        // Don't save CGLL fields from ICs to the restart file.
+        std::map<std::string,field_mgr_ptr> fms;
+        for (auto& it : m_field_mgrs) {
+          if (it.first == "Physics GLL") continue;
+          fms[it.first] = it.second;
+        }
+        om.set_logger(m_atm_logger);
+        om.setup(m_atm_comm,restart_pl,         fms,m_grids_manager,m_run_t0,m_case_t0,true);
+      } else {
+        om.set_logger(m_atm_logger);
+        om.setup(m_atm_comm,restart_pl,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,true);
+      }
       om.set_logger(m_atm_logger);
-      om.setup(m_atm_comm,restart_pl,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,true);
-    }
-    om.set_logger(m_atm_logger);
-    for (const auto& it : m_atm_process_group->get_restart_extra_data()) {
-      om.add_global(it.first,it.second);
+      for (const auto& it : m_atm_process_group->get_restart_extra_data()) {
+        om.add_global(it.first,it.second);
+      }
     }
 
     // Store the "Output Control" pl of the model restart as the "Checkpoint Control" for all other output streams
@@ -808,16 +838,29 @@ initialize_fields ()
   //       the IC file, and throw an error when the dag is created.
 
   auto& driver_options_pl = m_atm_params.sublist("driver_options");
-  const int verb_lvl = driver_options_pl.get<int>("atmosphere_dag_verbosity_level",-1);
-  if (verb_lvl>0) {
-    // Check the atm DAG for missing stuff
-    AtmProcDAG dag;
 
-    // First, add all atm processes
-    dag.create_dag(*m_atm_process_group);
+  // Create the atm DAG (and its execution plan), adding all atm processes
+  m_atm_dag.create_dag(*m_atm_process_group);
 
+  const int verb_lvl = driver_options_pl.get<int>("atmosphere_dag_verbosity_level",-1);
+  if (verb_lvl>0) {
     // Write a dot file for visualization
-    dag.write_dag("scream_atm_dag.dot",std::max(verb_lvl,0));
+    m_atm_dag.write_dag("scream_atm_dag.dot",std::max(verb_lvl,0));
+  }
+
+  // Dump the execution plan, with the critical path computed from the costs
+  // measured in the previous run (if any). Only root reads/writes the file.
+  m_atm_schedule_file = driver_options_pl.get<std::string>("atmosphere_schedule_file","");
+  if (m_atm_schedule_file!="" and m_atm_comm.am_i_root()) {
+    m_atm_dag.set_costs(AtmProcDAG::read_schedule_costs(m_atm_schedule_file));
+    m_atm_dag.write_schedule(m_atm_schedule_file);
+    std::string cp_msg = m_atm_dag.get_critical_path_cost()<0
+                       ? "unknown"
+                       : std::to_string(m_atm_dag.get_critical_path_cost()) + " s/step";
+    m_atm_logger->info("  [EAMxx] Atm processes schedule: "
+                       + std::to_string(m_atm_dag.get_execution_plan().size()) + " processes in "
+                       + std::to_string(m_atm_dag.get_num_levels()) + " levels, critical path from previous run: "
+                       + cp_msg + " (see " + m_atm_schedule_file + ")");
   }
 
   // Initialize fields
@@ -891,6 +934,12 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  if (binary_restart::is_binary_restart_file(filename)) {
+    restart_model_from_binary (filename);
+    m_atm_logger->info("  [EAMxx] restart_model ... done!");
+    return;
+  }
+
   for (auto& it : m_field_mgrs) {
     if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
     if (not it.second->has_group("RESTART")) {
@@ -935,6 +984,55 @@ void AtmosphereDriver::restart_model ()
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
 
+void AtmosphereDriver::restart_model_from_binary (const std::string& filename)
+{
+  BinaryRestartReader reader(filename,m_atm_comm);
+
+  for (auto& it : m_field_mgrs) {
+    if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
+    if (not it.second->has_group("RESTART")) {
+      // No field needs to be restarted on this grid.
+      continue;
+    }
+    const auto& restart_group = it.second->get_groups_info().at("RESTART");
+    std::vector<Field> fields;
+    for (const auto& fn : restart_group->m_fields_names) {
+      fields.push_back(it.second->get_field(fn));
+    }
+    reader.read_fields (fields,it.second->get_grid());
+    for (auto& f : fields) {
+      f.get_header().get_tracking().update_time_stamp(m_current_ts);
+    }
+  }
+
+  // Restart the num steps counter in the atm time stamp
+  const int nsteps = reader.get_num_steps();
+  m_current_ts.set_num_steps(nsteps);
+  m_run_t0.set_num_steps(nsteps);
+
+  for (auto& it : m_atm_process_group->get_restart_extra_data()) {
+    const auto& name = it.first;
+          auto& any  = it.second;
+
+    if (any.isType<int>()) {
+      ekat::any_cast<int>(any) = reader.get_global<int>(name);
+    } else if (any.isType<std::int64_t>()) {
+      ekat::any_cast<std::int64_t>(any) = reader.get_global<std::int64_t>(name);
+    } else if (any.isType<float>()) {
+      ekat::any_cast<float>(any) = reader.get_global<float>(name);
+    } else if (any.isType<double>()) {
+      ekat::any_cast<double>(any) = reader.get_global<double>(name);
+    } else if (any.isType<std::string>()) {
+      ekat::any_cast<std::string>(any) = reader.get_global<std::string>(name);
+    } else {
+      EKAT_ERROR_MSG (
+          "Error! Unrecognized/unsupported concrete type for restart extra data.\n"
+          " - extra data name  : " + name + "\n"
+          " - extra data typeid: " + any.content().type().name() + "\n");
+    }
+  }
+}
+
 void AtmosphereDriver::create_logger () {
   using namespace ekat::logger;
   using ci_string = ekat::CaseInsensitiveString;
@@ -1596,6 +1694,13 @@ void AtmosphereDriver::run (const int dt) {
     "Atmosphere step = " + std::to_string(m_current_ts.get_num_steps()) + "\n" +
     "  model start-of-step time = " + m_current_ts.get_date_string() + " " + m_current_ts.get_time_string() + "\n");
 
+  // If a binary checkpoint was written at the end of the previous step, make sure
+  // it is on disk and in rpointer.atm, so that a crash during this step does not
+  // restart from an older checkpoint
+  if (m_binary_restart_writer) {
+    m_binary_restart_writer->finish_pending_flush();
+  }
+
   // Reset accum fields to 0
   // Note: at the 1st timestep this is redundant, since we did it at init,
   //       to ensure t=0 INSTANT output was correct. However, it's not a
@@ -1625,16 +1730,23 @@ void AtmosphereDriver::run (const int dt) {
     }
 
     auto rescale_group = fm->get_field_group("DIVIDE_BY_DT");
-    for (auto f_it : rescale_group.m_fields) {
-      f_it.second->scale(Real(1) / dt);
-    }
+    scale(rescale_group, Real(1) / dt);
   }
 
+  // Some processes may still be running on a host thread; make sure their
+  // outputs are in the field manager before the output managers see them
+  m_atm_process_group->finish_pending_work();
+
   // Update current time stamps
   m_current_ts += dt;
 
   // Update output streams
   m_atm_logger->debug("[EAMxx::run] running output managers...");
+  if (m_binary_restart_writer) {
+    // Must run before the other streams, since it records rpointer.atm before
+    // the history restart streams append to it
+    m_binary_restart_writer->run(m_current_ts);
+  }
   for (auto& out_mgr : m_output_managers) {
     out_mgr.run(m_current_ts);
   }
@@ -1669,12 +1781,41 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  if (m_binary_restart_writer) {
+    // Wait for the last checkpoint to be flushed to disk
+    m_binary_restart_writer->finalize();
+    m_binary_restart_writer = nullptr;
+  }
+
+  // Update the schedule file with the costs measured in this run, so the next
+  // run can report its critical path. Use the slowest rank for each process.
+  if (m_atm_schedule_file!="" and m_atm_process_group.get()) {
+    const int nsteps = m_current_ts.get_num_steps() - m_run_t0.get_num_steps();
+    auto costs = m_atm_dag.measure_costs(nsteps);
+    if (costs.size()>0) {
+      std::vector<double> my_costs, max_costs(costs.size());
+      for (const auto& it : costs) {
+        my_costs.push_back(it.second);
+      }
+      m_atm_comm.all_reduce(my_costs.data(),max_costs.data(),costs.size(),MPI_MAX);
+      int i = 0;
+      for (auto& it : costs) {
+        it.second = max_costs[i++];
+      }
+      if (m_atm_comm.am_i_root()) {
+        m_atm_dag.set_costs(costs);
+        m_atm_dag.write_schedule(m_atm_schedule_file);
+      }
+    }
+  }
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
     m_atm_process_group->finalize( /* inputs ? */ );
     m_atm_process_group = nullptr;
   }
+  // The dag nodes store pointers to the atm processes
+  m_atm_dag = AtmProcDAG();
 
   // Destroy iop
   m_iop = nullptr;
@@ -1809,6 +1950,36 @@ void AtmosphereDriver::report_res_dep_memory_footprint () const {
   m_atm_comm.all_reduce(&my_mem_usage_from_os,&max_mem_usage_from_os,1,MPI_MAX);
   m_atm_logger->info("[EAMxx::init] memory usage from OS probing tools: " + std::to_string(max_mem_usage_from_os) + "MB");
 #endif
+
+#ifndef EAMXX_ENABLE_GPU
+  // With host-threaded builds on multi-socket nodes, check where the pages of the
+  // fields and of the atm buffer ended up (probing a sample of pages of each allocation)
+  std::map<int,long long> fields_placement;
+  for (const auto& fm_it : m_field_mgrs) {
+    for (const auto& it : *fm_it.second) {
+      const auto& f = *it.second;
+      const auto& fap = f.get_header().get_alloc_properties();
+      if (fap.is_subfield() or not f.is_allocated()) {
+        continue;
+      }
+      auto p = get_numa_placement(f.get_internal_view_data<const char>(),fap.get_alloc_size(),64);
+      for (const auto& node_it : p) {
+        fields_placement[node_it.first] += node_it.second;
+      }
+    }
+  }
+  auto buf_placement = get_numa_placement(m_memory_buffer->get_memory(),m_memory_buffer->allocated_bytes());
+  m_atm_logger->debug("[EAMxx::init] NUMA placement of fields pages on rank " + std::to_string(m_atm_comm.rank()) + ": "
+                      + numa_placement_string(fields_placement));
+  m_atm_logger->debug("[EAMxx::init] NUMA placement of atm buffer pages on rank " + std::to_string(m_atm_comm.rank()) + ": "
+                      + numa_placement_string(buf_placement));
+
+  // First-touch placement only helps if threads do not migrate across sockets afterwards
+  if (DefaultDevice::execution_space().concurrency()>1 and std::getenv("OMP_PROC_BIND")==nullptr) {
+    m_atm_logger->warn("[EAMxx::init] OMP_PROC_BIND is not set. Threads may migrate across NUMA nodes,\n"
+                       "  away from the memory pages they first touched. Consider OMP_PROC_BIND=spread or close.");
+  }
+#endif
 }
 
 }  // namespace control
@@ -8,9 +8,11 @@
 #include "share/util/scream_time_stamp.hpp"
 #include "share/scream_types.hpp"
 #include "share/io/scream_output_manager.hpp"
+#include "share/io/eamxx_binary_restart.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
 #include "share/atm_process/SCDataManager.hpp"
+#include "share/atm_process/atmosphere_process_dag.hpp"
 
 #include "ekat/logging/ekat_logger.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
@@ -163,6 +165,9 @@ public:
 
   const std::shared_ptr<AtmosphereProcessGroup>& get_atm_processes () const { return m_atm_process_group; }
 
+  // The atm processes dag, with the execution plan (available after initialize_fields)
+  const AtmProcDAG& get_atm_dag () const { return m_atm_dag; }
+
 #ifndef KOKKOS_ENABLE_CUDA
   // Cuda requires methods enclosing __device__ lambda's to be public
 protected:
@@ -175,6 +180,7 @@ protected:
   void create_logger ();
   void set_initial_conditions ();
   void restart_model ();
+  void restart_model_from_binary (const std::string& filename);
 
   // Read fields from a file when the names of the fields in
   // EAMxx do not match exactly with the .nc file. Example is
@@ -197,11 +203,17 @@ protected:
 
   std::shared_ptr<AtmosphereProcessGroup>   m_atm_process_group;
 
+  // The dag of the atm processes, along with their execution plan
+  AtmProcDAG                                m_atm_dag;
+  std::string                               m_atm_schedule_file;
+
   std::shared_ptr<GridsManager>             m_grids_manager;
 
   ekat::ParameterList                       m_atm_params;
 
   std::list<OutputManager>                  m_output_managers;
+  // If model restart uses the binary format, this replaces the model restart OutputManager
+  std::shared_ptr<BinaryRestartWriter>      m_binary_restart_writer;
 
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
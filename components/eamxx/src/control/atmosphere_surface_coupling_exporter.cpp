@@ -135,7 +135,8 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
   // The export data is of size ncols,num_cpl_exports. All other data is of size num_scream_exports
   m_cpl_exports_view_h = decltype(m_cpl_exports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_exports);
-  m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  m_exports_view_d = decltype(m_exports_view_d) ("exports", m_num_scream_exports, m_num_cols);
+  m_pipeline.setup(m_num_scream_exports, m_num_cols, m_params.get<int>("transfer_num_chunks",4));
 
   m_export_field_names = new name_t[m_num_scream_exports];
   std::memcpy(m_export_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_exports*32*sizeof(char));
@@ -156,6 +157,18 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_exports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  // The cpl fields we do not export only need to be zeroed on host
+  std::vector<bool> exported(m_num_cpl_exports,false);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    exported[m_cpl_indices_view(i)] = true;
+  }
+  m_cpl_indices_not_exported.clear();
+  for (int icpl=0; icpl<m_num_cpl_exports; ++icpl) {
+    if (not exported[icpl]) {
+      m_cpl_indices_not_exported.push_back(icpl);
+    }
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
@@ -533,30 +546,60 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
-  const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
-  const int  num_cols           = m_num_cols;
-  const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
-  Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+  const auto exports_view_d = m_exports_view_d;
+  const int  num_cols       = m_num_cols;
+  const auto col_info       = m_column_info_d;
+
+  // Any field not exported by scream is set to 0.0. This is done on host,
+  // while the device works on the export computations.
+  for (int icpl : m_cpl_indices_not_exported) {
+    for (int icol=0; icol<num_cols; ++icol) {
+      m_cpl_exports_view_h(icol,icpl) = 0;
+    }
+  }
+
+  // Only the exported fields are moved to host, one chunk at a time. While a
+  // chunk is packed on device and copied to its staging buffer, the host copies
+  // the previous chunk into the cpl array.
+  const int num_chunks = m_pipeline.num_chunks();
+  for (int ichunk=0; ichunk<=num_chunks; ++ichunk) {
+    // Wait for the previous chunk to land in its staging buffer
+    Kokkos::fence();
+
+    if (ichunk<num_chunks) {
+      const int begin = m_pipeline.begin(ichunk);
+      const int end   = m_pipeline.end(ichunk);
+
+      // Export to cpl data. Any field not exported during initialization is set to 0.0
+      auto export_policy = policy_type (begin*num_cols,end*num_cols);
+      Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
+        const int ifield = i / num_cols;
+        const int icol   = i % num_cols;
+        const auto& info = col_info(ifield);
+        const auto offset = icol*info.col_stride + info.col_offset;
+
+        // if this is during initialization, check whether or not the field should be exported
+        bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+        exports_view_d(ifield,icol) = do_export ? info.constant_multiple*info.data[offset] : 0;
+      });
+
+      auto chunk_d = Kokkos::subview(exports_view_d,std::make_pair(begin,end),Kokkos::ALL());
+      Kokkos::deep_copy(KT::ExeSpace(),m_pipeline.staging(ichunk),chunk_d);
     }
-  });
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+    if (ichunk>0) {
+      // Copy the previous chunk from its staging buffer to the cpl host array
+      const int  begin   = m_pipeline.begin(ichunk-1);
+      const int  end     = m_pipeline.end(ichunk-1);
+      const auto staging = m_pipeline.staging(ichunk-1);
+      for (int ifield=begin; ifield<end; ++ifield) {
+        const int icpl = m_column_info_h(ifield).cpl_indx;
+        for (int icol=0; icol<num_cols; ++icol) {
+          m_cpl_exports_view_h(icol,icpl) = staging(ifield-begin,icol);
+        }
+      }
+    }
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
@@ -11,6 +11,7 @@
 
 #include <ekat/ekat_parameter_list.hpp>
 #include <string>
+#include <vector>
 
 namespace scream
 {
@@ -135,12 +136,19 @@ protected:
   util::TimeInterpolation           m_time_interp;
   std::vector<std::string>          m_export_from_file_field_names;
 
-  // Views storing a 2d array with dims (num_cols,num_fields) for cpl export data.
+  // View storing a 2d array with dims (num_cols,num_fields) for cpl export data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole a2x array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
 
+  // Device copy of the exported fields only, with dims (num_scream_exports,num_cols).
+  // It is moved chunk by chunk to the pinned staging buffers of m_pipeline.
+  view_2d <DefaultDevice, Real> m_exports_view_d;
+  SurfaceCouplingPipeline       m_pipeline;
+
+  // Indices of the cpl fields that are not exported by eamxx (always set to 0)
+  std::vector<int>              m_cpl_indices_not_exported;
+
   // Array storing the field names for exports
   name_t*                   m_export_field_names;
   std::vector<std::string>  m_export_field_names_vector;
@@ -67,8 +67,8 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
   // The import data is of size ncols,num_cpl_imports. All other data is of size num_scream_imports
   m_cpl_imports_view_h = decltype(m_cpl_imports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_imports);
-  m_cpl_imports_view_d = Kokkos::create_mirror_view_and_copy(DefaultDevice(),
-                                                             m_cpl_imports_view_h);
+  m_imports_view_d = decltype(m_imports_view_d) ("imports", m_num_scream_imports, m_num_cols);
+  m_pipeline.setup(m_num_scream_imports, m_num_cols, m_params.get<int>("transfer_num_chunks",4));
   m_import_field_names = new name_t[m_num_scream_imports];
   std::memcpy(m_import_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_imports*32*sizeof(char));
 
@@ -139,44 +139,91 @@ void SurfaceCouplingImporter::run_impl (const double /* dt */)
 void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
 {
   using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
+  using exe_space   = KokkosTypes<DefaultDevice>::ExeSpace;
 
   // Local copies, to deal with CUDA's handling of *this
-  const auto col_info           = m_column_info_d;
-  const auto cpl_imports_view_d = m_cpl_imports_view_d;
-  const int  num_cols           = m_num_cols;
-  const int  num_imports        = m_num_scream_imports;
+  const auto col_info       = m_column_info_d;
+  const auto imports_view_d = m_imports_view_d;
+  const int  num_cols       = m_num_cols;
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  // Gather IOP surface data (if any), which replaces the cpl data during packing
+  m_iop_imports.clear();
+  if (m_iop) {
+    if (m_iop->get_params().get<bool>("iop_srf_prop")) {
+      overwrite_iop_imports(called_during_initialization);
+    }
+  }
+
+  // Only the imported cpl fields are moved to device, one chunk at a time.
+  // All device work goes on the same execution space instance, so the copy
+  // and unpack of a chunk are ordered, and the host is free to pack the next
+  // chunk in the meantime.
+  for (int ichunk=0; ichunk<m_pipeline.num_chunks(); ++ichunk) {
+    const int  begin   = m_pipeline.begin(ichunk);
+    const int  end     = m_pipeline.end(ichunk);
+    const auto staging = m_pipeline.staging(ichunk);
 
-  // Unpack the fields
-  auto unpack_policy = policy_type(0,num_imports*num_cols);
-  Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
+    pack_imports(staging,begin,end,called_during_initialization);
 
-    const auto& info = col_info(ifield);
+    // Wait for the previous chunk, so that its staging buffer
+    // can be packed while this chunk is on its way to device
+    Kokkos::fence();
+
+    auto chunk_d = Kokkos::subview(imports_view_d,std::make_pair(begin,end),Kokkos::ALL());
+    Kokkos::deep_copy(exe_space(),chunk_d,staging);
+
+    // Unpack the fields
+    auto unpack_policy = policy_type(begin*num_cols,end*num_cols);
+    Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
+      const int ifield = i / num_cols;
+      const int icol   = i % num_cols;
+
+      const auto& info = col_info(ifield);
+
+      auto offset = icol*info.col_stride + info.col_offset;
+
+      // if this is during initialization, check whether or not the field should be imported
+      bool do_import = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_import) {
+        info.data[offset] = imports_view_d(ifield,icol);
+      }
+    });
+  }
 
-    auto offset = icol*info.col_stride + info.col_offset;
+  // The staging buffers will be overwritten at the next import
+  Kokkos::fence();
+}
+// =========================================================================================
+void SurfaceCouplingImporter::
+pack_imports (const SurfaceCouplingStagingView& staging,
+              const int begin, const int end,
+              const bool called_during_initialization) const
+{
+  for (int ifield=begin; ifield<end; ++ifield) {
+    const auto& info = m_column_info_h(ifield);
 
-    // if this is during initialization, check whether or not the field should be imported
-    bool do_import = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_import) {
-      info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
+    // If we are in initialization and field should not be imported, skip
+    if (called_during_initialization && not info.transfer_during_initialization) {
+      continue;
     }
-  });
 
-  if (m_iop) {
-    if (m_iop->get_params().get<bool>("iop_srf_prop")) {
-      // Overwrite imports with data from IOP file
-      overwrite_iop_imports(called_during_initialization);
+    const int row = ifield - begin;
+    auto iop_it = m_iop_imports.find(ifield);
+    if (iop_it!=m_iop_imports.end()) {
+      const Real col_val = iop_it->second;
+      for (int icol=0; icol<m_num_cols; ++icol) {
+        staging(row,icol) = col_val;
+      }
+    } else {
+      for (int icol=0; icol<m_num_cols; ++icol) {
+        staging(row,icol) = m_cpl_imports_view_h(icol,info.cpl_indx)*info.constant_multiple;
+      }
     }
   }
 }
 // =========================================================================================
 void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_initialization)
 {
-  using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
   using C = physics::Constants<Real>;
 
   const auto has_lhflx = m_iop->has_iop_field("lhflx");
@@ -187,7 +234,6 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
   static constexpr Real stebol = C::stebol;
 
   const auto& col_info_h = m_column_info_h;
-  const auto& col_info_d = m_column_info_d;
 
   for (int ifield=0; ifield<m_num_scream_imports; ++ifield) {
     const std::string fname = m_import_field_names[ifield];
@@ -222,12 +268,7 @@ void SurfaceCouplingImporter::overwrite_iop_imports (const bool called_during_in
     }
 
     // Overwrite iop imports with col_val for each column
-    auto policy = policy_type(0, m_num_cols);
-    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& icol) {
-      const auto& info_d = col_info_d(ifield);
-      const auto offset = icol*info_d.col_stride + info_d.col_offset;
-      info_d.data[offset] = col_val;
-    });
+    m_iop_imports[ifield] = col_val;
   }
 }
 // =========================================================================================
@@ -8,6 +8,7 @@
 #include "surface_coupling_utils.hpp"
 
 #include <string>
+#include <map>
 
 namespace scream
 {
@@ -58,7 +59,9 @@ public:
   // Take and store data from SCDataManager
   void setup_surface_coupling_data(const SCDataManager &sc_data_manager);
 
-  // Overwrite imports for IOP cases with IOP file surface data
+  // Overwrite imports for IOP cases with IOP file surface data.
+  // Note: this only gathers the IOP values, which replace the cpl data
+  //       when the imports are packed in do_import().
   void overwrite_iop_imports (const bool called_during_initialization);
 
 protected:
@@ -68,6 +71,12 @@ protected:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Pack the cpl data of the imports in [begin,end) into the staging buffer,
+  // applying the constant multiple (or the IOP overwrite, if any).
+  void pack_imports (const SurfaceCouplingStagingView& staging,
+                     const int begin, const int end,
+                     const bool called_during_initialization) const;
+
   // Keep track of field dimensions
   Int m_num_cols;
 
@@ -77,12 +86,19 @@ protected:
   // Number of imports to SCREAM
   Int m_num_scream_imports;
 
-  // Views storing a 2d array with dims (num_cols,num_fields) for import data.
+  // View storing a 2d array with dims (num_cols,num_fields) for import data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole x2a array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_imports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_imports_view_h;
 
+  // Device copy of the imported fields only, with dims (num_scream_imports,num_cols).
+  // It is filled chunk by chunk from the pinned staging buffers of m_pipeline.
+  view_2d <DefaultDevice, Real> m_imports_view_d;
+  SurfaceCouplingPipeline       m_pipeline;
+
+  // IOP values overwriting the cpl data of some imports (import index -> value)
+  std::map<int,Real> m_iop_imports;
+
   // Array storing the field names for imports
   name_t* m_import_field_names;
 
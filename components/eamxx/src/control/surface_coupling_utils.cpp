@@ -71,4 +71,26 @@ void get_col_info_for_surface_values(const std::shared_ptr<const FieldHeader>& f
   }
 }
 
+void SurfaceCouplingPipeline::
+setup (const int num_fields, const int num_cols, const int num_chunks)
+{
+  EKAT_REQUIRE_MSG (num_chunks>0,
+      "Error! Invalid number of chunks for surface coupling transfers.\n"
+      "  - num chunks: " + std::to_string(num_chunks) + "\n");
+
+  m_num_fields = num_fields;
+  m_num_chunks = std::max(std::min(num_chunks,num_fields),1);
+  m_chunk_size = (num_fields + m_num_chunks - 1) / m_num_chunks;
+
+  // Adjust, in case the last chunk(s) would be empty
+  if (m_chunk_size>0) {
+    m_num_chunks = (num_fields + m_chunk_size - 1) / m_chunk_size;
+  }
+
+  const int num_buffers = std::min(m_num_chunks,2);
+  for (int i=0; i<num_buffers; ++i) {
+    m_buffers[i] = SurfaceCouplingStagingView("cpl_staging_"+std::to_string(i),m_chunk_size,num_cols);
+  }
+}
+
 } // namespace scream
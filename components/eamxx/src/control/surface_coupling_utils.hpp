@@ -4,6 +4,8 @@
 #include "share/scream_types.hpp"
 #include "share/field/field.hpp"
 
+#include <algorithm>
+
 namespace scream {
 
 // Enum for distiguishing between an import or export 
@@ -73,6 +75,38 @@ struct SurfaceCouplingColumnInfo {
 void get_col_info_for_surface_values(const std::shared_ptr<const FieldHeader>& fh,
                                      int vecComp, int& col_offset, int& col_stride);
 
+// Pinned host memory used to stage surface data moving between the cpl arrays
+// and device. Page-locked memory allows the host<->device copies to be done
+// asynchronously (and at full bandwidth) on GPU builds. On CPU builds this is
+// simply host memory.
+using SurfaceCouplingStagingView =
+  Kokkos::View<Real**,Kokkos::LayoutRight,Kokkos::SharedHostPinnedSpace>;
+
+// Helper to pipeline the transfer of a set of surface fields. The fields are
+// split in chunks, which alternate between two staging buffers: while the data
+// of one chunk is copied/processed on device, the host can work on the other.
+struct SurfaceCouplingPipeline {
+  void setup (const int num_fields, const int num_cols, const int num_chunks);
+
+  int num_chunks () const { return m_num_chunks; }
+
+  // Range [begin,end) of field indices belonging to a chunk
+  int begin (const int ichunk) const { return ichunk*m_chunk_size; }
+  int end   (const int ichunk) const { return std::min((ichunk+1)*m_chunk_size,m_num_fields); }
+
+  // The staging buffer used by a chunk, with dims (end-begin,num_cols)
+  SurfaceCouplingStagingView staging (const int ichunk) const {
+    return Kokkos::subview(m_buffers[ichunk%2],std::make_pair(0,end(ichunk)-begin(ichunk)),Kokkos::ALL());
+  }
+
+protected:
+  int m_num_fields = 0;
+  int m_num_chunks = 0;
+  int m_chunk_size = 0;
+
+  SurfaceCouplingStagingView m_buffers[2];
+};
+
 } // namespace scream
 
 #endif // SCREAM_SURFACE_COUPLING_UTILS_HPP
@@ -70,11 +70,6 @@ void AeroComCld::set_grids(
   add_field<Required>("nc", scalar2d_layout, 1 / kg, grid_name);
   add_field<Required>("ni", scalar2d_layout, 1 / kg, grid_name);
 
-  // A field to store dz
-  FieldIdentifier m_dz_fid("dz", scalar2d_layout, m, grid_name);
-  m_dz = Field(m_dz_fid);
-  m_dz.allocate_view();
-
   // Construct and allocate the output field
   FieldIdentifier fid(name(), vector1d_layout, nondim, grid_name);
   m_diagnostic_output = Field(fid);
@@ -99,9 +94,8 @@ void AeroComCld::compute_diagnostic_impl() {
    * equation 13, the column counterpart. The order is reversed to calculate
    * cloud-bottom properties as well.
    */
-  using KT  = KokkosTypes<DefaultDevice>;
-  using MT  = typename KT::MemberType;
-  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using KT = KokkosTypes<DefaultDevice>;
+  using RP = typename KT::RangePolicy;
 
   using PF = scream::PhysicsFunctions<DefaultDevice>;
 
@@ -118,8 +112,6 @@ void AeroComCld::compute_diagnostic_impl() {
   const auto nc   = get_field_in("nc").get_view<const Real **>();
   const auto ni   = get_field_in("ni").get_view<const Real **>();
 
-  auto dz = m_dz.get_view<Real **>();
-
   // Get gravity acceleration constant from constants
   using physconst = scream::physics::Constants<Real>;
 
@@ -127,13 +119,8 @@ void AeroComCld::compute_diagnostic_impl() {
   auto q_threshold           = q_thresh_set();
   auto cldfrac_tot_threshold = cldfrac_tot_thresh_set();
 
-  const auto policy = ESU::get_default_team_policy(m_ncols, m_nlevs);
-
   const auto out = m_diagnostic_output.get_view<Real **>();
 
-  // zero out the outputs
-  Kokkos::deep_copy(out, 0.0);
-
   const int nlevs = m_nlevs;
   bool is_top     = (m_topbot == "Top");
 
@@ -149,71 +136,64 @@ void AeroComCld::compute_diagnostic_impl() {
   auto o_ni            = ekat::subview_1(out, m_index_map["ni"]);
   auto o_cldfrac_tot   = ekat::subview_1(out, m_index_map["cldfrac_tot"]);
 
+  // The accumulation over levels is inherently serial, so use one thread per
+  // column, and accumulate all the cloud top/bot properties in registers in a
+  // single pass over the column. dz is only needed (and computed) in cloudy layers.
   Kokkos::parallel_for(
-      "Compute " + name(), policy, KOKKOS_LAMBDA(const MT &team) {
-        const int icol = team.league_rank();
-        // Subview the inputs at icol
-        auto tmid_icol = ekat::subview(tmid, icol);
-        auto pden_icol = ekat::subview(pden, icol);
-        auto pmid_icol = ekat::subview(pmid, icol);
-        auto qv_icol   = ekat::subview(qv, icol);
-        auto qc_icol   = ekat::subview(qc, icol);
-        auto qi_icol   = ekat::subview(qi, icol);
-        auto rel_icol  = ekat::subview(rel, icol);
-        auto rei_icol  = ekat::subview(rei, icol);
-        auto cld_icol  = ekat::subview(cld, icol);
-        auto nc_icol   = ekat::subview(nc, icol);
-        auto ni_icol   = ekat::subview(ni, icol);
-
-        // We need dz too
-        auto dz_icol = ekat::subview(dz, icol);
-        PF::calculate_dz(team, pden_icol, pmid_icol, tmid_icol, qv_icol,
-                         dz_icol);
-
+      "Compute " + name(), RP(0, m_ncols), KOKKOS_LAMBDA(const int icol) {
         // Initialize the 1D "clear fraction" as 1 (totally clear)
         auto clr_icol = 1.0;
 
+        Real tmid_acc = 0, pmid_acc = 0, cldfrac_ice_acc = 0, cldfrac_liq_acc = 0;
+        Real cdnc_acc = 0, nc_acc = 0, ni_acc = 0, rel_acc = 0, rei_acc = 0;
+
         // Loop over all layers in serial (due to accumulative
         // product), starting at 2 (second highest) layer because the
         // highest is assumed to hav no clouds for cldtop, but starting
         // at m_nlevs-1 for cldbot
 
         auto topbot_calcs = [&](int ilay) {
+          const Real qc_ilay  = qc(icol, ilay);
+          const Real qi_ilay  = qi(icol, ilay);
+          const Real cld_ilay = cld(icol, ilay);
           // Only do the calculation if certain conditions are met
-          if((qc_icol(ilay) + qi_icol(ilay)) > q_threshold &&
-             (cld_icol(ilay) > cldfrac_tot_threshold)) {
+          if((qc_ilay + qi_ilay) > q_threshold &&
+             (cld_ilay > cldfrac_tot_threshold)) {
             /* PART I: Probabilistically determining cloud top/bot */
             // Populate clr_tmp as the clear-sky fraction
             // probability of this level, where clr_icol is that of
             // the previous level
+            const Real cld_prev = cld(icol, ilay - 1);
             auto clr_tmp =
                 clr_icol *
-                (1.0 - ekat::impl::max(cld_icol(ilay - 1), cld_icol(ilay))) /
-                (1.0 - ekat::impl::min(cld_icol(ilay - 1),
+                (1.0 - ekat::impl::max(cld_prev, cld_ilay)) /
+                (1.0 - ekat::impl::min(cld_prev,
                                        Real(1.0 - cldfrac_tot_threshold)));
             // Temporary variable for probability "weights"
             auto wts = clr_icol - clr_tmp;
             // Temporary variable for liquid "phase"
-            auto phi = qc_icol(ilay) / (qc_icol(ilay) + qi_icol(ilay));
+            auto phi = qc_ilay / (qc_ilay + qi_ilay);
             /* PART II: The inferred properties */
             /* In general, converting a 3D property X to a 2D cloud-top
              * counterpart x follows: x(i) += X(i,k) * weights * Phase
              * but X and Phase are not always needed */
-            o_tmid(icol) += tmid_icol(ilay) * wts;
-            o_pmid(icol) += pmid_icol(ilay) * wts;
-            o_cldfrac_ice(icol) += (1.0 - phi) * wts;
-            o_cldfrac_liq(icol) += phi * wts;
+            tmid_acc += tmid(icol, ilay) * wts;
+            pmid_acc += pmid(icol, ilay) * wts;
+            cldfrac_ice_acc += (1.0 - phi) * wts;
+            cldfrac_liq_acc += phi * wts;
             // cdnc
             /* We need to convert nc from 1/mass to 1/volume first, and
              * from grid-mean to in-cloud, but after that, the
              * calculation follows the general logic */
-            auto cdnc = nc_icol(ilay) * pden_icol(ilay) / dz_icol(ilay) /
-                        physconst::gravit / cld_icol(ilay);
-            o_cdnc(icol) += cdnc * phi * wts;
-            o_nc(icol) += nc_icol(ilay) * phi * wts;
-            o_ni(icol) += ni_icol(ilay) * (1.0 - phi) * wts;
-            o_eff_radius_qc(icol) += rel_icol(ilay) * phi * wts;
-            o_eff_radius_qi(icol) += rei_icol(ilay) * (1.0 - phi) * wts;
+            const Real dz = PF::calculate_dz(pden(icol, ilay), pmid(icol, ilay),
+                                             tmid(icol, ilay), qv(icol, ilay));
+            auto cdnc = nc(icol, ilay) * pden(icol, ilay) / dz /
+                        physconst::gravit / cld_ilay;
+            cdnc_acc += cdnc * phi * wts;
+            nc_acc += nc(icol, ilay) * phi * wts;
+            ni_acc += ni(icol, ilay) * (1.0 - phi) * wts;
+            rel_acc += rel(icol, ilay) * phi * wts;
+            rei_acc += rei(icol, ilay) * (1.0 - phi) * wts;
             // Reset clr_icol to clr_tmp to accumulate
             clr_icol = clr_tmp;
           }
@@ -229,6 +209,16 @@ void AeroComCld::compute_diagnostic_impl() {
           }
         }
 
+        o_tmid(icol)          = tmid_acc;
+        o_pmid(icol)          = pmid_acc;
+        o_cldfrac_ice(icol)   = cldfrac_ice_acc;
+        o_cldfrac_liq(icol)   = cldfrac_liq_acc;
+        o_cdnc(icol)          = cdnc_acc;
+        o_nc(icol)            = nc_acc;
+        o_ni(icol)            = ni_acc;
+        o_eff_radius_qc(icol) = rel_acc;
+        o_eff_radius_qi(icol) = rei_acc;
+
         // After the serial loop over levels, the cloudy fraction is
         // defined as (1 - clr_icol). This is true because
         // clr_icol is the result of accumulative probabilities
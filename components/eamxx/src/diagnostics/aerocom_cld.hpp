@@ -40,9 +40,6 @@ class AeroComCld : public AtmosphereDiagnostic {
   // Attribute maps for self-documentation
   std::map<std::string, int> m_index_map;
   std::map<std::string, std::string> m_units_map;
-
-  // Set a field for dz
-  Field m_dz;
 };
 
 }  // namespace scream
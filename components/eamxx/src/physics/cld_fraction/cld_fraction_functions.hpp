@@ -53,6 +53,20 @@ struct CldFractionFunctions
     const view_2d<Pack>& ice_cld_frac_4out, 
     const view_2d<Pack>& tot_cld_frac_4out);
 
+  // Computes all the cloud fraction variants in a single pass over the column
+  KOKKOS_FUNCTION
+  static void calc_cldfrac(
+    const MemberType& team,
+    const Int& nk,
+    const Real& ice_threshold,
+    const Real& ice_4out_threshold,
+    const uview_1d<const Spack>& qi,
+    const uview_1d<const Spack>& liq_cld_frac,
+    const uview_1d<Spack>&       ice_cld_frac,
+    const uview_1d<Spack>&       tot_cld_frac,
+    const uview_1d<Spack>&       ice_cld_frac_4out,
+    const uview_1d<Spack>&       tot_cld_frac_4out);
+
   KOKKOS_FUNCTION
   static void calc_icefrac( 
     const MemberType& team,
@@ -39,11 +39,8 @@ void CldFractionFunctions<S,D>
     const auto oice_cld_frac_4out = ekat::subview(ice_cld_frac_4out, i);
     const auto otot_cld_frac_4out = ekat::subview(tot_cld_frac_4out, i);
 
-    calc_icefrac(team,nk,ice_threshold,oqi,oice_cld_frac);
-    calc_icefrac(team,nk,ice_4out_threshold, oqi,oice_cld_frac_4out);
-
-    calc_totalfrac(team,nk,oliq_cld_frac,oice_cld_frac,otot_cld_frac);
-    calc_totalfrac(team,nk,oliq_cld_frac,oice_cld_frac_4out,otot_cld_frac_4out);
+    calc_cldfrac(team,nk,ice_threshold,ice_4out_threshold,oqi,oliq_cld_frac,
+                 oice_cld_frac,otot_cld_frac,oice_cld_frac_4out,otot_cld_frac_4out);
   });
   Kokkos::fence();
 } // main
@@ -51,6 +48,41 @@ void CldFractionFunctions<S,D>
 template <typename S, typename D>
 KOKKOS_FUNCTION
 void CldFractionFunctions<S,D>
+::calc_cldfrac(
+  const MemberType& team,
+  const Int& nk,
+  const Real& ice_threshold,
+  const Real& ice_4out_threshold,
+  const uview_1d<const Spack>& qi,
+  const uview_1d<const Spack>& liq_cld_frac,
+  const uview_1d<Spack>&       ice_cld_frac,
+  const uview_1d<Spack>&       tot_cld_frac,
+  const uview_1d<Spack>&       ice_cld_frac_4out,
+  const uview_1d<Spack>&       tot_cld_frac_4out)
+{
+  // Same as calc_icefrac+calc_totalfrac for both thresholds, but the inputs
+  // are only loaded once, and the outputs only stored once, with no barrier
+  // between the different variants.
+  const Int nk_pack = ekat::npack<Spack>(nk);
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+      const auto qi_k  = qi(k);
+      const auto liq_k = liq_cld_frac(k);
+
+      Spack ice_k(0.0), ice_4out_k(0.0);
+      ice_k.set(qi_k > ice_threshold, 1.0);
+      ice_4out_k.set(qi_k > ice_4out_threshold, 1.0);
+
+      ice_cld_frac(k)      = ice_k;
+      ice_cld_frac_4out(k) = ice_4out_k;
+      tot_cld_frac(k)      = max(ice_k,liq_k);
+      tot_cld_frac_4out(k) = max(ice_4out_k,liq_k);
+  }); // Kokkos_parallel_for nk_pack
+} // calc_cldfrac
+/*-----------------------------------------------------------------*/
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void CldFractionFunctions<S,D>
 ::calc_icefrac(
   const MemberType& team,
   const Int& nk,
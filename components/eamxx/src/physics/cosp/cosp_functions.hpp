@@ -29,67 +29,102 @@ namespace scream {
         inline void finalize() {
             cosp_c2f_final();
         };
-        inline void main(
-                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
-                view_1d<const Real>& sunlit , view_1d<const Real>& skt,
-                view_2d<const Real>& T_mid  , view_2d<const Real>& p_mid  , view_2d<const Real>& p_int,
-                view_2d<const Real>& z_mid  , view_2d<const Real>& qv     , view_2d<const Real>& qc     , view_2d<const Real>& qi,
-                view_2d<const Real>& cldfrac,
-                view_2d<const Real>& reff_qc, view_2d<const Real>& reff_qi,
-                view_2d<const Real>& dtau067, view_2d<const Real>& dtau105,
-                view_1d<Real>& isccp_cldtot , view_3d<Real>& isccp_ctptau, view_3d<Real>& modis_ctptau, view_3d<Real>& misr_cthtau) {
+        // Persistent host storage for one COSP call, in the layout expected by F90.
+        // Inputs are filled on the main thread (see snapshot), then the simulator
+        // (see run) only touches these views, so that it can execute while the
+        // main thread moves on with the rest of the atm step.
+        struct Staging {
+            Staging () = default;
+            Staging (const Int ncol, const Int nlay, const Int ntau, const Int nctp, const Int ncth)
+             : sunlit("sunlit_h", ncol), skt("skt_h", ncol)
+             , T_mid("T_mid_h", ncol, nlay), p_mid("p_mid_h", ncol, nlay), p_int("p_int_h", ncol, nlay+1)
+             , z_mid("z_mid_h", ncol, nlay), qv("qv_h", ncol, nlay), qc("qc_h", ncol, nlay), qi("qi_h", ncol, nlay)
+             , cldfrac("cldfrac_h", ncol, nlay)
+             , reff_qc("reff_qc_h", ncol, nlay), reff_qi("reff_qi_h", ncol, nlay)
+             , dtau067("dtau_067_h", ncol, nlay), dtau105("dtau105_h", ncol, nlay)
+             , isccp_cldtot("isccp_cldtot_h", ncol)
+             , isccp_ctptau("isccp_ctptau_h", ncol, ntau, nctp)
+             , modis_ctptau("modis_ctptau_h", ncol, ntau, nctp)
+             , misr_cthtau("misr_cthtau_h", ncol, ntau, ncth)
+            {}
 
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
+            lview_host_1d sunlit, skt;
+            lview_host_2d T_mid, p_mid, p_int, z_mid, qv, qc, qi, cldfrac,
+                          reff_qc, reff_qi, dtau067, dtau105;
+            lview_host_1d isccp_cldtot;
+            lview_host_3d isccp_ctptau, modis_ctptau, misr_cthtau;
+        };
 
-            // Copy to layoutLeft host views
+        // Copy (and permute) the inputs into the staging views
+        inline void snapshot(
+                const Staging& s,
+                const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
+                const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  , const view_2d<const Real>& p_int,
+                const view_2d<const Real>& z_mid  , const view_2d<const Real>& qv     , const view_2d<const Real>& qc     , const view_2d<const Real>& qi,
+                const view_2d<const Real>& cldfrac,
+                const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
+                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105) {
+            const int ncol = s.T_mid.extent(0);
+            const int nlay = s.T_mid.extent(1);
             for (int i = 0; i < ncol; i++) {
+                s.sunlit(i) = sunlit(i);
+                s.skt(i) = skt(i);
                 for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
+                    s.T_mid(i,j) = T_mid(i,j);
+                    s.p_mid(i,j) = p_mid(i,j);
+                    s.z_mid(i,j) = z_mid(i,j);
+                    s.qv(i,j) = qv(i,j);
+                    s.qc(i,j) = qc(i,j);
+                    s.qi(i,j) = qi(i,j);
+                    s.cldfrac(i,j) = cldfrac(i,j);
+                    s.reff_qc(i,j) = reff_qc(i,j);
+                    s.reff_qi(i,j) = reff_qi(i,j);
+                    s.dtau067(i,j) = dtau067(i,j);
+                    s.dtau105(i,j) = dtau105(i,j);
                 }
-            }
-            for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
+                    s.p_int(i,j) = p_int(i,j);
                 }
             }
+        }
+
+        // Call the COSP wrapper on the staged inputs. This only uses plain loops and
+        // the F90 bridge (no Kokkos dispatch), so it is safe to call from a host thread
+        // other than the one driving the atm step.
+        inline void run(const Staging& s, const Int nsubcol, const Real emsfc_lw) {
+            const int ncol = s.T_mid.extent(0);
+            const int nlay = s.T_mid.extent(1);
+            const int ntau = s.isccp_ctptau.extent(1);
+            const int nctp = s.isccp_ctptau.extent(2);
+            const int ncth = s.misr_cthtau.extent(2);
 
             // Subsample here?
 
-            // Call COSP wrapper
             cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
+                    emsfc_lw, s.sunlit.data(), s.skt.data(), s.T_mid.data(), s.p_mid.data(), s.p_int.data(),
+                    s.z_mid.data(), s.qv.data(), s.qc.data(), s.qi.data(),
+                    s.cldfrac.data(), s.reff_qc.data(), s.reff_qi.data(), s.dtau067.data(), s.dtau105.data(),
+                    s.isccp_cldtot.data(), s.isccp_ctptau.data(), s.modis_ctptau.data(), s.misr_cthtau.data());
+        }
 
-            // Copy outputs back to layoutRight views
+        // Copy outputs back to layoutRight views
+        inline void publish(
+                const Staging& s,
+                const view_1d<Real>& isccp_cldtot, const view_3d<Real>& isccp_ctptau,
+                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
+            const int ncol = s.isccp_ctptau.extent(0);
+            const int ntau = s.isccp_ctptau.extent(1);
+            const int nctp = s.isccp_ctptau.extent(2);
+            const int ncth = s.misr_cthtau.extent(2);
             for (int i = 0; i < ncol; i++) {
+                isccp_cldtot(i) = s.isccp_cldtot(i);
                 for (int j = 0; j < ntau; j++) {
                     for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
+                        isccp_ctptau(i,j,k) = s.isccp_ctptau(i,j,k);
+                        modis_ctptau(i,j,k) = s.modis_ctptau(i,j,k);
                     }
                     for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
+                        misr_cthtau(i,j,k) = s.misr_cthtau(i,j,k);
                     }
                 }
             }
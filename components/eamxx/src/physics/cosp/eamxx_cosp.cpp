@@ -8,6 +8,7 @@
 #include "share/field/field_utils.hpp"
 
 #include <array>
+#include <future>
 
 namespace scream
 {
@@ -25,6 +26,9 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether the simulator can run on a host thread while the atm step proceeds
+  m_run_async = m_params.get<bool>("cosp_async", false);
 }
 
 // =========================================================================================
@@ -101,6 +105,10 @@ void Cosp::initialize_impl (const RunType /* run_type */)
   // Set property checks for fields in this process
   CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
 
+  // Allocate host staging once, rather than at every COSP step
+  m_staging = CospFunc::Staging(m_num_cols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth);
+  m_z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
+  m_z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
 
   // Add note to output files about processing ISCCP fields that are only valid during
   // daytime. This can go away once I/O can handle masked time averages.
@@ -134,12 +142,33 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
+  // In case nobody waited on the previous COSP step (e.g., this process is
+  // run outside of the AD), make sure the simulator is done
+  finish_pending_work();
+
+  if (not update_cosp) {
+    // If not updating COSP statistics, set these to ZERO; this essentially weights
+    // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
+    // then is the time-average mask-weighted statistics; to get true averages, we need to
+    // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
+    // statistic, then
+    //
+    //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
+    //
+    // TODO: mask this when/if the AD ever supports masked averages
+    // Note: this is done on device, so no host-device transfer happens on non-COSP steps
+    get_field_out("isccp_cldtot").deep_copy(0.0);
+    get_field_out("isccp_ctptau").deep_copy(0.0);
+    get_field_out("modis_ctptau").deep_copy(0.0);
+    get_field_out("misr_cthtau").deep_copy(0.0);
+    get_field_out("cosp_sunlit").deep_copy(0.0);
+    return;
+  }
+
   // Get fields from field manager; note that we get host views because this
   // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
   // all then need to be copied to layoutLeft views to permute the indices for
   // F90.
-  //
-  // Need to make sure device data is synced to host?
   get_field_in("qv").sync_to_host();
   get_field_in("qc").sync_to_host();
   get_field_in("qi").sync_to_host();
@@ -171,15 +200,10 @@ void Cosp::run_impl (const double dt)
   auto reff_qi = get_field_in("eff_radius_qi").get_view<const Real**, Host>();
   auto dtau067 = get_field_in("dtau067").get_view<const Real**, Host>();
   auto dtau105 = get_field_in("dtau105").get_view<const Real**, Host>();
-  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*, Host>();
-  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***, Host>();
-  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***, Host>();
-  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***, Host>();
-  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();  // Copy of sunlit flag with COSP frequency for proper averaging
 
   // Compute heights
-  const auto z_mid = CospFunc::view_2d<Real>("z_mid", m_num_cols, m_num_levs);
-  const auto z_int = CospFunc::view_2d<Real>("z_int", m_num_cols, m_num_levs+1);
+  const auto z_mid = m_z_mid;
+  const auto z_int = m_z_int;
   const auto dz = z_mid;  // reuse tmp memory for dz
   const auto ncol = m_num_cols;
   const auto nlev = m_num_levs;
@@ -203,49 +227,68 @@ void Cosp::run_impl (const double dt)
       PF::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
       team.team_barrier();
   });
+  Kokkos::fence();
+
+  // Snapshot the inputs, so that the simulator no longer depends on the field manager
+  CospFunc::snapshot(m_staging,
+          sunlit, skt, T_mid, p_mid, p_int, z_mid, qv, qc, qi,
+          cldfrac, reff_qc, reff_qi, dtau067, dtau105);
 
-  // Call COSP wrapper routines
-  if (update_cosp) {
-    Real emsfc_lw = 0.99;
-    Kokkos::deep_copy(cosp_sunlit, sunlit);
-    CospFunc::view_2d<const Real> z_mid_c = z_mid;  // Need a const version of z_mid for call to CospFunc::main
-    CospFunc::main(
-            m_num_cols, m_num_subcols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth,
-            emsfc_lw, sunlit, skt, T_mid, p_mid, p_int, z_mid_c, qv, qc, qi,
-            cldfrac, reff_qc, reff_qi, dtau067, dtau105,
-            isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau
-    );
-    // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
-    // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
-    for (int i = 0; i < m_num_cols; i++) {
-        if (sunlit(i) == 0) {
-            isccp_cldtot(i) = 0;
-            for (int j = 0; j < m_num_tau; j++) {
-                for (int k = 0; k < m_num_ctp; k++) {
-                    isccp_ctptau(i,j,k) = 0;
-                    modis_ctptau(i,j,k) = 0;
-                }
-                for (int k = 0; k < m_num_cth; k++) {
-                    misr_cthtau (i,j,k) = 0;
-                }
-            }
-        }
-    }
+  // Call COSP wrapper routines. The COSP F90 state is only ever touched by one
+  // thread at a time, since we always wait on the previous call before launching.
+  const Real emsfc_lw = 0.99;
+  const auto staging = m_staging;
+  const auto nsubcol = m_num_subcols;
+  if (m_run_async) {
+    // Note: the worker gets the default thread stack size, not OMP_STACKSIZE,
+    // which may be too small for the COSP F90 stack arrays (hence the opt-in).
+    m_pending = std::async(std::launch::async, [=]() {
+      CospFunc::run(staging, nsubcol, emsfc_lw);
+    });
   } else {
-    // If not updating COSP statistics, set these to ZERO; this essentially weights
-    // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
-    // then is the time-average mask-weighted statistics; to get true averages, we need to
-    // divide by the time-average of the mask. I.e., if M is the sunlit mask, and X is the ISCCP
-    // statistic, then
-    //
-    //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
-    //
-    // TODO: mask this when/if the AD ever supports masked averages
-    Kokkos::deep_copy(isccp_cldtot, 0.0);
-    Kokkos::deep_copy(isccp_ctptau, 0.0);
-    Kokkos::deep_copy(modis_ctptau, 0.0);
-    Kokkos::deep_copy(misr_cthtau, 0.0);
-    Kokkos::deep_copy(cosp_sunlit, 0.0);
+    CospFunc::run(staging, nsubcol, emsfc_lw);
+  }
+  m_has_pending_outputs = true;
+}
+
+// =========================================================================================
+void Cosp::finish_pending_work ()
+{
+  if (not m_has_pending_outputs) {
+    return;
+  }
+  m_has_pending_outputs = false;
+
+  // Rethrows any exception raised by the simulator
+  if (m_pending.valid()) {
+    m_pending.get();
+  }
+
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*, Host>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***, Host>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***, Host>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***, Host>();
+  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*, Host>();  // Copy of sunlit flag with COSP frequency for proper averaging
+
+  CospFunc::publish(m_staging, isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau);
+
+  // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
+  // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
+  const auto sunlit = m_staging.sunlit;
+  for (int i = 0; i < m_num_cols; i++) {
+      cosp_sunlit(i) = sunlit(i);
+      if (sunlit(i) == 0) {
+          isccp_cldtot(i) = 0;
+          for (int j = 0; j < m_num_tau; j++) {
+              for (int k = 0; k < m_num_ctp; k++) {
+                  isccp_ctptau(i,j,k) = 0;
+                  modis_ctptau(i,j,k) = 0;
+              }
+              for (int k = 0; k < m_num_cth; k++) {
+                  misr_cthtau (i,j,k) = 0;
+              }
+          }
+      }
   }
   get_field_out("isccp_cldtot").sync_to_dev();
   get_field_out("isccp_ctptau").sync_to_dev();
@@ -257,7 +300,8 @@ void Cosp::run_impl (const double dt)
 // =========================================================================================
 void Cosp::finalize_impl()
 {
-  // Finalize COSP wrappers
+  // Make sure the simulator is not running, then finalize COSP wrappers
+  finish_pending_work();
   CospFunc::finalize();
 }
 // =========================================================================================
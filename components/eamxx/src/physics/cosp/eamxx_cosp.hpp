@@ -1,10 +1,12 @@
 #ifndef SCREAM_COSP_HPP
 #define SCREAM_COSP_HPP
 
+#include "cosp_functions.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
+#include <future>
 #include <string>
 
 namespace scream
@@ -36,6 +38,9 @@ public:
   // Set the grid
   void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
 
+  // Wait for the simulator (if running) and publish its outputs
+  void finish_pending_work ();
+
   inline bool cosp_do(const int icosp, const int nstep) {
       // If icosp == 0, then never do cosp;
       // Otherwise, we always call cosp at the first step,
@@ -75,6 +80,19 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // If true, the simulator runs on a separate host thread (see finish_pending_work)
+  bool m_run_async;
+
+  // Persistent host storage for the simulator inputs/outputs, and scratch for heights
+  CospFunc::Staging        m_staging;
+  CospFunc::view_2d<Real>  m_z_mid;
+  CospFunc::view_2d<Real>  m_z_int;
+
+  // Handle to the simulator running on the host thread, if any, and whether
+  // the outputs of the last COSP call still need to be copied in the fields
+  std::future<void>        m_pending;
+  bool                     m_has_pending_outputs = false;
+
 }; // class Cosp
 
 } // namespace scream
@@ -251,6 +251,9 @@ void MAMMicrophysics::initialize_impl(const RunType run_type) {
                                         config_.photolysis.rsf_file,
                                         config_.photolysis.xs_long_file);
 
+  // allocate storage for the gas phase chemistry state of all cells
+  gas_chem_ = impl::GasPhaseChemistryBatch(ncol_, nlev_);
+
   // FIXME: read relevant land use data from drydep surface file
 
   // set up our preprocess/postprocess functors
@@ -288,10 +291,6 @@ void MAMMicrophysics::run_impl(const double dt) {
   // NOTE: nothing depends on simulation time (yet), so we can just use zero for now
   double t = 0.0;
 
-  // here's where we store per-column photolysis rates
-  using View2D = haero::DeviceType::view_2d<Real>;
-  View2D photo_rates("photo_rates", nlev_, mam4::mo_photo::phtcnt);
-
   // climatology data for linear stratospheric chemistry
   auto linoz_o3_clim      = buffer_.scratch[0]; // ozone (climatology) [vmr]
   auto linoz_o3col_clim   = buffer_.scratch[1]; // column o3 above box (climatology) [Dobson Units (DU)]
@@ -310,35 +309,35 @@ void MAMMicrophysics::run_impl(const double dt) {
   mam_coupling::DryAtmosphere &dry_atm =  dry_atm_;
   mam_coupling::AerosolState  &dry_aero = dry_aero_;
   mam4::mo_photo::PhotoTableData &photo_table = photo_table_;
+  const impl::GasPhaseChemistryBatch &gas_chem = gas_chem_;
   const int nlev = nlev_;
   const Config &config = config_;
   // FIXME: read relevant linoz climatology data from file(s) based on time
 
   // FIXME: read relevant chlorine loading data from file based on time
 
-  // loop over atmosphere columns and compute aerosol microphyscs
-  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
-    const int icol = team.league_rank(); // column index
+  // The microphysics is done in three steps:
+  //  1. column-wise: compute photolysis rates and external forcings, and
+  //     store the (pre-chemistry) gas/aerosol VMRs of each cell
+  //  2. cell-wise: solve gas phase chemistry for all (column, level) cells
+  //  3. column-wise: aqueous chemistry, aerosol microphysics, LINOZ
+  // Gas phase chemistry is by far the most expensive part, and each cell is
+  // an independent system, so it is solved in a flat loop over all cells (see
+  // impl/gas_phase_chemistry.hpp), rather than with nlev threads per column.
 
-    Real col_lat = col_latitudes(icol); // column latitude (degrees?)
+  Kokkos::parallel_for("photolysis", policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
+    const int icol = team.league_rank(); // column index
 
     // fetch column-specific atmosphere state data
     auto atm = mam_coupling::atmosphere_for_column(dry_atm, icol);
-    auto z_iface = ekat::subview(dry_atm.z_iface, icol);
-    Real phis = dry_atm.phis(icol);
-
-    // set surface state data
-    haero::Surface sfc{};
 
     // fetch column-specific subviews into aerosol prognostics
     mam4::Prognostics progs = mam_coupling::interstitial_aerosols_for_column(dry_aero, icol);
 
-    // set up diagnostics
-    mam4::Diagnostics diags(nlev);
-
     // calculate o3 column densities (first component of col_dens in Fortran code)
     auto o3_col_dens_i = ekat::subview(o3_col_dens, icol);
     impl::compute_o3_column_density(team, atm, progs, o3_col_dens_i);
+    team.team_barrier();
 
     // set up photolysis work arrays for this column.
     mam4::mo_photo::PhotoTableWorkArrays photo_work_arrays;
@@ -351,15 +350,57 @@ void MAMMicrophysics::run_impl(const double dt) {
     Real surf_albedo = 0.0; // FIXME: surface albedo
     Real esfact = 0.0; // FIXME: earth-sun distance factor
     mam4::ColumnView lwc; // FIXME: liquid water cloud content: where do we get this?
-    mam4::mo_photo::table_photo(photo_rates, atm.pressure, atm.hydrostatic_dp,
-      atm.temperature, o3_col_dens_i, zenith_angle, surf_albedo, lwc,
-      atm.cloud_fraction, esfact, photo_table, photo_work_arrays);
+    mam4::mo_photo::table_photo(ekat::subview(gas_chem.photo_rates, icol),
+      atm.pressure, atm.hydrostatic_dp, atm.temperature, o3_col_dens_i,
+      zenith_angle, surf_albedo, lwc, atm.cloud_fraction, esfact, photo_table,
+      photo_work_arrays);
 
     // compute external forcings at time t(n+1) [molecules/cm^3/s]
     constexpr int extcnt = mam4::gas_chemistry::extcnt;
-    view_2d extfrc; // FIXME: where to allocate? (nlev, extcnt)
     mam4::mo_setext::Forcing forcings[extcnt]; // FIXME: forcings seem to require file data
-    mam4::mo_setext::extfrc_set(forcings, extfrc);
+    mam4::mo_setext::extfrc_set(forcings, ekat::subview(gas_chem.extfrc, icol));
+
+    // store the VMRs of each level, which gas phase chemistry updates in place
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](const int k) {
+      constexpr int gas_pcnst = mam_coupling::gas_pcnst();
+      Real q[gas_pcnst] = {};
+      Real qqcw[gas_pcnst] = {};
+      mam_coupling::transfer_prognostics_to_work_arrays(progs, k, q, qqcw);
+      Real vmr[gas_pcnst], vmrcw[gas_pcnst];
+      mam_coupling::convert_work_arrays_to_vmr(q, qqcw, vmr, vmrcw);
+      const int c = gas_chem.cell(icol, k);
+      for (int i = 0; i < gas_pcnst; ++i) {
+        gas_chem.vmr(i, c) = vmr[i];
+      }
+    });
+  });
+
+  //---------------------
+  // Gas Phase Chemistry
+  //---------------------
+  impl::solve_gas_phase_chemistry(dry_atm, gas_chem, dt);
+
+  // loop over atmosphere columns and compute aerosol microphyscs
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const ThreadTeam& team) {
+    const int icol = team.league_rank(); // column index
+
+    Real col_lat = col_latitudes(icol); // column latitude (degrees?)
+
+    // fetch column-specific atmosphere state data
+    auto atm = mam_coupling::atmosphere_for_column(dry_atm, icol);
+
+    // set surface state data
+    haero::Surface sfc{};
+
+    // fetch column-specific subviews into aerosol prognostics
+    mam4::Prognostics progs = mam_coupling::interstitial_aerosols_for_column(dry_aero, icol);
+
+    // set up diagnostics
+    mam4::Diagnostics diags(nlev);
+
+    auto o3_col_dens_i = ekat::subview(o3_col_dens, icol);
+    Real zenith_angle = 0.0; // FIXME: need to get this from EAMxx [radians]
+    mam4::ColumnView lwc; // FIXME: liquid water cloud content: where do we get this?
 
     // compute aerosol microphysics on each vertical level within this column
     Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nlev), [&](const int k) {
@@ -373,7 +414,6 @@ void MAMMicrophysics::run_impl(const double dt) {
       Real pmid    = atm.pressure(k);
       Real pdel    = atm.hydrostatic_dp(k);
       Real zm      = atm.height(k);
-      Real zi      = z_iface(k);
       Real pblh    = atm.planetary_boundary_layer_height;
       Real qv      = atm.vapor_mixing_ratio(k);
       Real cldfrac = atm.cloud_fraction(k);
@@ -404,23 +444,16 @@ void MAMMicrophysics::run_impl(const double dt) {
         vmrcw_precldchem[i] = vmrcw[i];
       }
 
-      //---------------------
-      // Gas Phase Chemistry
-      //---------------------
-      Real photo_rates_k[mam4::mo_photo::phtcnt];
-      for (int i = 0; i < mam4::mo_photo::phtcnt; ++i) {
-        photo_rates_k[i] = photo_rates(k, i);
-      }
-      Real extfrc_k[extcnt];
-      for (int i = 0; i < extcnt; ++i) {
-        extfrc_k[i] = extfrc(k, i);
+      // fetch the results of gas phase chemistry
+      const int c = gas_chem.cell(icol, k);
+      for (int i = 0; i < gas_pcnst; ++i) {
+        vmr[i] = gas_chem.vmr(i, c);
       }
       constexpr int nfs = mam4::gas_chemistry::nfs; // number of "fixed species"
-      // NOTE: we compute invariants here and pass them out to use later with
-      // NOTE: setsox
       Real invariants[nfs];
-      impl::gas_phase_chemistry(zm, zi, phis, temp, pmid, pdel, dt,
-                                photo_rates_k, extfrc_k, vmr, invariants);
+      for (int i = 0; i < nfs; ++i) {
+        invariants[i] = gas_chem.invariants(i, c);
+      }
 
       //----------------------
       // Aerosol microphysics
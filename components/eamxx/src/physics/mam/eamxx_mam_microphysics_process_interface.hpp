@@ -6,6 +6,7 @@
 #include <share/util/scream_common_physics_functions.hpp>
 
 #include "impl/mam4_amicphys.cpp" // mam4xx top-level microphysics function(s)
+#include "impl/gas_phase_chemistry.hpp" // batched gas phase chemistry solver
 
 #include <ekat/ekat_parameter_list.hpp>
 #include <ekat/ekat_workspace.hpp>
@@ -207,6 +208,9 @@ private_except_cuda:
   // photolysis rate table (column-independent)
   mam4::mo_photo::PhotoTableData photo_table_;
 
+  // gas phase chemistry state of all (column, level) cells
+  impl::GasPhaseChemistryBatch gas_chem_;
+
   // column areas, latitudes, longitudes
   const_view_1d col_areas_, col_latitudes_, col_longitudes_;
 
@@ -105,8 +105,7 @@ void Functions<S,D>
 
     rho(k)          = dpres(k)/dz(k) / g;
     inv_rho(k)      = 1 / rho(k);
-    qv_sat_l(k)     = physics::qv_sat_dry(T_atm(k), pres(k), false, range_mask, physics::MurphyKoop, "p3::p3_main_part1 (liquid)");
-    qv_sat_i(k)     = physics::qv_sat_dry(T_atm(k), pres(k), true,  range_mask, physics::MurphyKoop, "p3::p3_main_part1 (ice)");
+    physics::qv_sat_dry_liq_ice(T_atm(k), pres(k), range_mask, qv_sat_l(k), qv_sat_i(k), physics::MurphyKoop, "p3::p3_main_part1");
 
     qv_supersat_i(k) = qv(k) / qv_sat_i(k) - 1;
 
@@ -24,7 +24,7 @@ template <typename ScalarT, typename DeviceT>
 struct Functions
 {
 
-  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1};
+  enum SaturationFcn { Polysvp1 = 0, MurphyKoop = 1, MurphyKoopFast = 2};
 
   //
   // ------- Types --------
@@ -92,6 +92,12 @@ struct Functions
   KOKKOS_FUNCTION
   static Spack MurphyKoop_svp(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
 
+  //  fast, tabulated version of MurphyKoop_svp (max relative error 1.2e-9 in
+  //  double precision), falling back to MurphyKoop_svp outside 150 K <= t < 342 K.
+  //  Same units and arguments as MurphyKoop_svp.
+  KOKKOS_FUNCTION
+  static Spack MurphyKoop_svp_fast(const Spack& t, const bool ice, const Smask& range_mask, const char* caller=nullptr);
+
   // Calls a function to obtain the saturation vapor pressure, and then computes
   // and returns the dry saturation mixing ratio, with respect to either liquid or ice,
   // depending on value of 'ice'
@@ -103,6 +109,12 @@ struct Functions
   static Spack qv_sat_wet(const Spack& t_atm, const Spack& p_atm, const bool ice, const Smask& range_mask, const Spack& dp_wet, const Spack& dp_dry, 
                           const SaturationFcn func_idx = MurphyKoop, const char* caller=nullptr);
 
+  // Computes the dry saturation mixing ratios w.r.t. both liquid and ice,
+  // evaluating the saturation vapor pressure only once for entries at or above Tmelt
+  KOKKOS_FUNCTION
+  static void qv_sat_dry_liq_ice(const Spack& t_atm, const Spack& p_atm, const Smask& range_mask, Spack& qv_sat_l, Spack& qv_sat_i,
+                                 const SaturationFcn func_idx = MurphyKoop, const char* caller=nullptr);
+
   //checks temperature for negatives and NaNs
   KOKKOS_FUNCTION
   static void check_temperature(const Spack& t_atm, const char* caller, const Smask& range_mask);
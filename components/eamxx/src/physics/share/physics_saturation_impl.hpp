@@ -81,6 +81,96 @@ Functions<S,D>::MurphyKoop_svp(const Spack& t_atm, const bool ice, const Smask&
   return result;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Spack
+Functions<S,D>::MurphyKoop_svp_fast(const Spack& t_atm, const bool ice, const Smask& range_mask, const char* caller)
+{
+
+  //First check if the temperature is legitimate or not
+  check_temperature(t_atm, caller ? caller : "MurphyKoop_svp_fast", range_mask);
+
+  //ln(e_s) of equations (7) and (10) of Murphy and Koop (2005) is tabulated as
+  //degree-10 Chebyshev expansions on 32 K wide intervals starting at 150 K, so
+  //that e_s costs a single exp instead of an exp, a log and a tanh. Max relative
+  //error w.r.t. MurphyKoop_svp is 1.2e-9 (liquid) and 3e-13 (ice) in double
+  //precision. Temperatures outside the tabulated range use MurphyKoop_svp.
+  static constexpr Scalar tbeg  = 150;
+  static constexpr Scalar width = 32;
+  static constexpr int nliq = 6, nice = 4, ncoef = 11;
+  static constexpr Scalar lq[nliq][ncoef] = {
+    {-7.43058424946722162e+00, 3.46246226685697023e+00, -1.65634727565401291e-01, 7.81894020225948339e-03,
+     -3.74205225083750804e-04, 1.64566820582866633e-05, -1.16358547589098560e-06, 1.69427784933098082e-10,
+     -5.32560436154612576e-09, 7.65875443872490964e-11, 4.17467272871941898e-11},
+    {-1.59533442856493513e+00, 2.42586026286087630e+00, -1.01817179011156861e-01, 3.00732738851658150e-03,
+     -2.69056590575028111e-04, 1.24000649323557415e-05, 4.63352083788428447e-06, 6.35502099509789198e-07,
+     -5.74011885700155196e-08, -3.02074343720577925e-08, -3.32700467176039183e-09},
+    {2.53519756157953235e+00, 1.72920134911647372e+00, -7.14780786104482063e-02, 3.11162257904886537e-03,
+     1.75533957483719014e-05, -4.08486807472539155e-05, 1.27195770595964963e-06, 1.51713701335154383e-06,
+     -2.10576085437417432e-07, -3.63408897015431027e-08, 1.23246498461394467e-08},
+    {5.52244521557050572e+00, 1.28105669233342545e+00, -4.38719260720158155e-02, 1.43381464977751266e-03,
+     -6.39125519685408819e-05, 6.44443477168269130e-06, -6.93318823766472579e-07, 2.88952855178401732e-08,
+     7.49810686267499658e-09, -2.09827504866149727e-09, 2.86464851839696166e-10},
+    {7.77964460010307324e+00, 9.87225407652116083e-01, -3.05039523159288915e-02, 8.87173528556737439e-04,
+     -2.19344036693769340e-05, 4.38461133582408900e-07, -2.00200478417400518e-08, 3.55486250537172645e-09,
+     -5.03486222411001219e-10, 5.19977596334022322e-11, -4.06702954142639859e-12},
+    {9.53995126653319403e+00, 7.80395730158027545e-01, -2.17130811936812051e-02, 5.95598538315236055e-04,
+     -1.48216512051132820e-05, 3.15460920739176585e-07, -3.55770071988362451e-09, -1.25872484152916343e-10,
+     6.24147198571087982e-12, 5.60521326323479061e-13, -1.23577915577367415e-13}};
+  static constexpr Scalar ic[nice][ncoef] = {
+    {-8.25681649595090761e+00, 3.57103506804518966e+00, -1.69890336920279522e-01, 8.07393704330908527e-03,
+     -3.86809402565998822e-04, 1.85920547421341630e-05, -8.95102948367759274e-07, 4.31349709890066004e-08,
+     -2.07990005016902385e-09, 1.00333882616351645e-10, -4.83023722030008157e-12},
+    {-2.22648946956714022e+00, 2.51653186186860145e+00, -1.00778024611102371e-01, 4.00049958171034767e-03,
+     -1.60322564234634398e-04, 6.44995900955791512e-06, -2.59997091008172420e-07, 1.04922466674524494e-08,
+     -4.23714073928170934e-10, 1.71200023854370648e-11, -6.91729501960997579e-13},
+    {2.12691043841940974e+00, 1.86672975859084200e+00, -6.47848278467321043e-02, 2.20641284672657865e-03,
+     -7.59723798088711319e-05, 2.62763804319150873e-06, -9.10870930499867033e-08, 3.16164462539751537e-09,
+     -1.09831525187751509e-10, 3.81713852445645064e-12, -1.33879649790522776e-13},
+    {5.41357177974861870e+00, 1.43704192613388071e+00, -4.41837466898846107e-02, 1.31678375659991724e-03,
+     -3.97312616213987084e-05, 1.20488630644450212e-06, -3.66329512179287482e-08, 1.11541741499753379e-09,
+     -3.39963209099054923e-11, 1.03412228275539576e-12, -3.49013747195799222e-14}};
+
+  const auto chebyshev = [&] (const Scalar* c, const Spack& x) {
+    Spack b1(0), b2(0);
+    for (int j = ncoef-1; j > 0; --j) {
+      const Spack b0 = sp(2)*x*b1 - b2 + c[j];
+      b2 = b1;
+      b1 = b0;
+    }
+    return x*b1 - b2 + c[0];
+  };
+
+  Spack result;
+  static constexpr  auto tmelt = C::Tmelt;
+  const Smask ice_mask = (t_atm < tmelt) && ice;
+  Smask done(false);
+
+  for (int i = 0; i < nliq; ++i) {
+    const Scalar tlo = tbeg + i*width;
+    const Smask in_interval = (t_atm >= tlo) && (t_atm < tlo + width) && range_mask;
+    if (!in_interval.any()) continue;
+
+    const Spack x = (sp(2)*(t_atm - tlo) - width)/width;
+    const Smask liq_mask = in_interval && !ice_mask;
+    if (liq_mask.any()) {
+      result.set(liq_mask, exp(chebyshev(lq[i], x)));
+    }
+    const Smask ice_interval_mask = in_interval && ice_mask;
+    if (i < nice && ice_interval_mask.any()) {
+      result.set(ice_interval_mask, exp(chebyshev(ic[i], x)));
+    }
+    done = done || in_interval;
+  }
+
+  const Smask exact_mask = !done && range_mask;
+  if (exact_mask.any()) {
+    result.set(exact_mask, MurphyKoop_svp(t_atm, ice, range_mask, caller));
+  }
+
+  return result;
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 typename Functions<S,D>::Spack
@@ -137,7 +227,8 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
   func_idx is an optional argument to decide which scheme is to be called for saturation vapor pressure
   Currently default is set to "MurphyKoop_svp"
   func_idx = Polysvp1 (=0) --> polysvp1 (Flatau et al. 1992)
-  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)*/
+  func_idx = MurphyKoop (=1) --> MurphyKoop_svp (Murphy, D. M., and T. Koop 2005)
+  func_idx = MurphyKoopFast (=2) --> MurphyKoop_svp_fast (tabulated fit of MurphyKoop_svp)*/
 
   Spack e_pres; // saturation vapor pressure [Pa]
 
@@ -148,6 +239,9 @@ Functions<S,D>::qv_sat_dry(const Spack& t_atm, const Spack& p_atm_dry, const boo
     case MurphyKoop:
       e_pres = MurphyKoop_svp(t_atm, ice, range_mask, caller);
       break;
+    case MurphyKoopFast:
+      e_pres = MurphyKoop_svp_fast(t_atm, ice, range_mask, caller);
+      break;
     default:
       EKAT_KERNEL_ERROR_MSG("Error! Invalid func_idx supplied to qv_sat_dry.");
     }
@@ -179,6 +273,24 @@ Functions<S,D>::qv_sat_wet(const Spack& t_atm, const Spack& p_atm_dry, const boo
   return qsatdry * dp_dry / dp_wet;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::qv_sat_dry_liq_ice(const Spack& t_atm, const Spack& p_atm_dry, const Smask& range_mask,
+                                        Spack& qv_sat_l, Spack& qv_sat_i, const SaturationFcn func_idx, const char* caller)
+{
+  //At or above Tmelt, saturation w.r.t. ice is computed with the liquid
+  //formula, so evaluate the ice formula only if some entry is below Tmelt.
+  static constexpr  auto tmelt = C::Tmelt;
+
+  qv_sat_l = qv_sat_dry(t_atm, p_atm_dry, false, range_mask, func_idx, caller);
+  qv_sat_i = qv_sat_l;
+
+  const Smask ice_mask = (t_atm < tmelt) && range_mask;
+  if (ice_mask.any()) {
+    qv_sat_i.set(ice_mask, qv_sat_dry(t_atm, p_atm_dry, true, range_mask, func_idx, caller));
+  }
+}
+
 
 
 } // namespace physics
@@ -0,0 +1,115 @@
+#include "catch2/catch.hpp"
+
+#include "physics/share/physics_functions.hpp"
+#include "physics/share/physics_saturation_impl.hpp"
+#include "physics_unit_tests_common.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace scream {
+namespace physics {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::TestSaturationFast
+{
+  // Compare MurphyKoop_svp_fast against MurphyKoop_svp on a fine temperature
+  // sweep that also covers the temperatures handled by the exact fallback.
+  static void test_max_relative_error ()
+  {
+    using physics = Functions;
+
+    static constexpr Scalar tmin = 100, tmax = 360, dt = 0.01;
+    const int nt = static_cast<int>((tmax - tmin)/dt) + 1;
+    const int npack = ekat::npack<Spack>(nt);
+
+    view_2d<Spack> exact("exact", 2, npack), fast("fast", 2, npack);
+    Kokkos::parallel_for(RangePolicy(0, npack), KOKKOS_LAMBDA (const int& k) {
+      const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+      const Smask range_mask = range_pack < nt;
+      Spack t;
+      for (int s = 0; s < Spack::n; ++s) t[s] = tmin + (k*Spack::n + s)*dt;
+      for (int ice = 0; ice < 2; ++ice) {
+        exact(ice,k) = physics::MurphyKoop_svp(t, ice, range_mask);
+        fast(ice,k)  = physics::MurphyKoop_svp_fast(t, ice, range_mask);
+      }
+    });
+
+    const auto exact_h = Kokkos::create_mirror_view(exact);
+    const auto fast_h  = Kokkos::create_mirror_view(fast);
+    Kokkos::deep_copy(exact_h, exact);
+    Kokkos::deep_copy(fast_h, fast);
+
+    // The fit error is 1.2e-9; in single precision the evaluation of either
+    // formula dominates.
+    const Scalar tol = std::is_same<Scalar,float>::value ? 5e-5 : 5e-9;
+    for (int ice = 0; ice < 2; ++ice) {
+      Scalar max_rel_err = 0;
+      for (int i = 0; i < nt; ++i) {
+        const auto e = exact_h(ice, i / Spack::n)[i % Spack::n];
+        const auto f = fast_h(ice, i / Spack::n)[i % Spack::n];
+        max_rel_err = std::max(max_rel_err, std::abs(f - e)/e);
+      }
+      REQUIRE(max_rel_err < tol);
+    }
+  }
+
+  // qv_sat_dry_liq_ice must match two qv_sat_dry calls bit for bit.
+  static void test_liq_ice ()
+  {
+    using physics = Functions;
+
+    static constexpr Scalar tmin = 180, tmax = 320, dt = 0.5, pres = 7e4;
+    const int nt = static_cast<int>((tmax - tmin)/dt) + 1;
+    const int npack = ekat::npack<Spack>(nt);
+
+    view_2d<Spack> sep("sep", 2, npack), comb("comb", 2, npack);
+    Kokkos::parallel_for(RangePolicy(0, npack), KOKKOS_LAMBDA (const int& k) {
+      const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+      const Smask range_mask = range_pack < nt;
+      Spack t;
+      for (int s = 0; s < Spack::n; ++s) t[s] = tmin + (k*Spack::n + s)*dt;
+      const Spack p(pres);
+      sep(0,k) = physics::qv_sat_dry(t, p, false, range_mask);
+      sep(1,k) = physics::qv_sat_dry(t, p, true,  range_mask);
+      physics::qv_sat_dry_liq_ice(t, p, range_mask, comb(0,k), comb(1,k));
+    });
+
+    const auto sep_h  = Kokkos::create_mirror_view(sep);
+    const auto comb_h = Kokkos::create_mirror_view(comb);
+    Kokkos::deep_copy(sep_h, sep);
+    Kokkos::deep_copy(comb_h, comb);
+
+    for (int j = 0; j < 2; ++j) {
+      for (int i = 0; i < nt; ++i) {
+        REQUIRE(comb_h(j, i / Spack::n)[i % Spack::n] == sep_h(j, i / Spack::n)[i % Spack::n]);
+      }
+    }
+  }
+
+  static void run()
+  {
+    test_max_relative_error();
+    test_liq_ice();
+  }
+};
+
+} // namespace unit_test
+} // namespace physics
+} // namespace scream
+
+namespace {
+
+TEST_CASE("physics_saturation_fast", "[physics_saturation]")
+{
+  scream::physics::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestSaturationFast::run();
+}
+
+} // namespace
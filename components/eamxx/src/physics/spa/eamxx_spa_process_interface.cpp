@@ -89,9 +89,10 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   m_num_src_levs = io_grid->get_num_vertical_levels();
   SPAData_start = SPAFunc::SPAInput(m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_end   = SPAFunc::SPAInput(m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
+  SPAData_next  = SPAFunc::SPAInput(m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
   SPAData_out.init(m_num_cols,m_num_levs,m_nswbands,m_nlwbands,false);
 
-  // 3 Read in hyam/hybm in start/end data, and pad them
+  // 3 Read in hyam/hybm in start/end/next data, and pad them
   Field hyam(FieldIdentifier("hyam",io_grid->get_vertical_layout(true),nondim,io_grid->name()));
   Field hybm(FieldIdentifier("hybm",io_grid->get_vertical_layout(true),nondim,io_grid->name()));
   hyam.allocate_view();
@@ -106,7 +107,7 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   auto hyam_h = hyam.get_view<const Real*,Host>();
   auto hybm_h = hybm.get_view<const Real*,Host>();
   auto nlevs = io_grid->get_num_vertical_levels();
-  for (auto data : {SPAData_start, SPAData_end} ) {
+  for (auto data : {SPAData_start, SPAData_end, SPAData_next} ) {
     auto spa_hyam = ekat::scalarize(data.hyam);
     auto spa_hybm = ekat::scalarize(data.hybm);
     auto spa_hyam_h = Kokkos::create_mirror_view(spa_hyam);
@@ -220,6 +221,8 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPAData_out.AER_TAU_SW = get_field_out("aero_tau_sw").get_view<Spack***>();
   SPAData_out.AER_TAU_LW = get_field_out("aero_tau_lw").get_view<Spack***>();
 
+  SPAVertInterp = std::make_shared<SPAFunc::LIV>(m_num_cols,m_num_src_levs+2,m_num_levs);
+
   // Load the first month into spa_end.
   // Note: At the first time step, the data will be moved into spa_beg,
   //       and spa_end will be reloaded from file with the new month.
@@ -245,13 +248,15 @@ void SPA::run_impl (const double dt)
   auto ts = timestamp()+dt;
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
-  /* Update time state and if the month has changed, update the data.*/
-    SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  /* Update time state and if the month has changed, update the data.
+   * The following month is loaded ahead of time, so the month change is just a swap. */
+  SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,
+                                SPAData_start,SPAData_end,SPAData_next,SPAPrefetchState);
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,*SPAVertInterp);
 }
 
 // =========================================================================================
@@ -90,6 +90,13 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // Data for the month after SPAData_end, loaded ahead of the month change
+  SPAFunc::SPAInput         SPAData_next;
+  SPAFunc::SPAPrefetchState SPAPrefetchState;
+
+  // The vertical interpolation object, reused at every step
+  std::shared_ptr<SPAFunc::LIV> SPAVertInterp;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA
 
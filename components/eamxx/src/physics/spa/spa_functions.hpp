@@ -9,6 +9,7 @@
 #include "share/scream_types.hpp"
 
 #include <ekat/ekat_pack_utils.hpp>
+#include <ekat/util/ekat_lin_interp.hpp>
 
 namespace scream {
 namespace spa {
@@ -32,6 +33,8 @@ struct SPAFunctions
 
   using iop_ptr_type = std::shared_ptr<control::IntensiveObservationPeriod>;
 
+  using LIV = ekat::LinInterp<Real,Spack::n>;
+
   template <typename S>
   using view_1d = typename KT::template view_1d<S>;
   template <typename S>
@@ -66,6 +69,15 @@ struct SPAFunctions
     Real days_this_month;
   }; // SPATimeState
 
+  // Keeps track of the data for the month after the end month, which is loaded
+  // ahead of time (see update_spa_timestate), one stage per time step.
+  struct SPAPrefetchState {
+    // The month (0-based) whose data is fully loaded in the prefetch buffer, or -1
+    int month = -1;
+    // The month (0-based) whose data was read from file, but not yet remapped, or -1
+    int month_read = -1;
+  }; // SPAPrefetchState
+
   struct SPAData {
     SPAData() = default;
     SPAData(const int ncol_, const int nlev_, const int nswbands_, const int nlwbands_)
@@ -188,6 +200,17 @@ struct SPAFunctions
     const SPAInput&   data_tmp,         // Temporary
     const SPAOutput&  data_out);
 
+  // Same as above, but reusing a vertical interpolation object across calls
+  static void spa_main(
+    const SPATimeState& time_state,
+    const view_2d<const Spack>& p_tgt,
+    const view_2d<      Spack>& p_src,  // Temporary
+    const SPAInput&   data_beg,
+    const SPAInput&   data_end,
+    const SPAInput&   data_tmp,         // Temporary
+    const SPAOutput&  data_out,
+    const LIV&        vert_interp);
+
   static void update_spa_data_from_file(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
     std::shared_ptr<IOPReader>&       iop_reader,
@@ -196,6 +219,18 @@ struct SPAFunctions
     AbstractRemapper&                 spa_horiz_interp,
     SPAInput&                         spa_input);
 
+  // The two stages of update_spa_data_from_file: read data in the src fields
+  // of the horiz remapper, and remap/pad it into spa_input
+  static void read_spa_data_from_file(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    const int                         time_index); // zero-based
+
+  static void remap_spa_data(
+    AbstractRemapper&                 spa_horiz_interp,
+    SPAInput&                         spa_input);
+
   static void update_spa_timestate(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
     std::shared_ptr<IOPReader>&       iop_reader,
@@ -205,7 +240,20 @@ struct SPAFunctions
     SPAInput&                         spa_beg,
     SPAInput&                         spa_end);
 
-  // The following three are called during spa_main
+  // Same as above, but the data for the month after spa_end is prefetched in
+  // spa_next during the current month, so that the month change does no I/O
+  static void update_spa_timestate(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    AbstractRemapper&                 spa_horiz_interp,
+    SPATimeState&                     time_state,
+    SPAInput&                         spa_beg,
+    SPAInput&                         spa_end,
+    SPAInput&                         spa_next,
+    SPAPrefetchState&                 prefetch_state);
+
+  // The following three perform the same steps as spa_main, one full pass at a time
   static void perform_time_interpolation (
       const SPATimeState& time_state,
       const SPAInput&  data_beg,
@@ -204,6 +204,26 @@ void SPAFunctions<S,D>
   const SPAInput&   data_tmp,
   const SPAOutput&  data_out)
 {
+  LIV vert_interp(data_out.ncols,data_tmp.data.nlevs,data_out.nlevs);
+  spa_main(time_state,p_tgt,p_src,data_beg,data_end,data_tmp,data_out,vert_interp);
+}
+
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_2d<      Spack>& p_src,
+  const SPAInput&   data_beg,
+  const SPAInput&   data_end,
+  const SPAInput&   data_tmp,
+  const SPAOutput&  data_out,
+  const LIV&        vert_interp)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+  using C = scream::physics::Constants<Real>;
+
   // Beg/End/Tmp month must have all sizes matching
   EKAT_REQUIRE_MSG (
       data_end.data.nswbands==data_beg.data.nswbands &&
@@ -232,14 +252,76 @@ void SPAFunctions<S,D>
       "Error! Horizontal interpolation is performed *before* calling spa_main,\n"
       "       SPAInput and SPAOutput data structs must have the same number columns.\n");
 
-  // Step 1. Perform time interpolation
-  perform_time_interpolation(time_state,data_beg,data_end,data_tmp);
+  // NOTE: we *assume* data_beg and data_end have the *same* hybrid v coords.
+  //       IF this ever ceases to be the case, you can interp those too.
+  constexpr auto P0 = C::P0;
+
+  const auto delta_t_fraction = (time_state.t_now-time_state.t_beg_month) / time_state.days_this_month;
+  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
+      "Error! Convex interpolation with coefficient out of [0,1].\n"
+      "  t_now  : " + std::to_string(time_state.t_now) + "\n"
+      "  t_beg  : " + std::to_string(time_state.t_beg_month) + "\n"
+      "  delta_t: " + std::to_string(time_state.days_this_month) + "\n");
+
+  const int ncols          = data_out.ncols;
+  const int num_vars       = 1+data_beg.data.nswbands*3+data_beg.data.nlwbands;
+  const int num_src_packs  = ekat::PackInfo<Spack::n>::num_packs(data_beg.data.nlevs);
+  const int num_tgt_packs  = ekat::PackInfo<Spack::n>::num_packs(data_out.nlevs);
+  const auto ps_beg = data_beg.PS;
+  const auto ps_end = data_end.PS;
+  const auto ps_tmp = data_tmp.PS;
+  const auto hyam   = data_beg.hyam;
+  const auto hybm   = data_beg.hybm;
+
+  // Step 1. For each column, interpolate PS in time, build the source pressure
+  //         levels, and find the brackets of the target levels within them.
+  //         The brackets are shared by all variables/bands of the column.
+  const auto policy_setup = ESU::get_default_team_policy(ncols, num_src_packs);
+  Kokkos::parallel_for("spa_vert_interp_setup_loop", policy_setup,
+    KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+
+    const Real ps = linear_interp(ps_beg(icol),ps_end(icol),delta_t_fraction);
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      ps_tmp(icol) = ps;
+    });
+
+    const auto p_src_col = ekat::subview(p_src,icol);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,num_src_packs),
+                         [&](const int k) {
+      p_src_col(k) = ps * hybm(k)  + P0 * hyam(k);
+    });
+    team.team_barrier();
+
+    vert_interp.setup(team, p_src_col, ekat::subview(p_tgt,icol), icol);
+  });
+  Kokkos::fence();
 
-  // Step 2. Compute source pressure levels
-  compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
+  // Step 2. For each variable/band of each column, interpolate the source data
+  //         in time, then apply the vertical interpolation.
+  const auto policy_interp = ESU::get_default_team_policy(ncols*num_vars, num_tgt_packs);
+  Kokkos::parallel_for("spa_interp_loop", policy_interp,
+    KOKKOS_LAMBDA(const MemberType& team) {
 
-  // Step 3. Perform vertical interpolation
-  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
+    // The policy is over ncols*num_vars, so retrieve icol/ivar
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+
+    const auto var_beg = get_var_column (data_beg.data,icol,ivar);
+    const auto var_end = get_var_column (data_end.data,icol,ivar);
+    const auto var_tmp = get_var_column (data_tmp.data,icol,ivar);
+    const auto var_out = get_var_column (data_out,icol,ivar);
+
+    Kokkos::parallel_for (Kokkos::TeamVectorRange(team,num_src_packs),
+                          [&] (const int& k) {
+      var_tmp(k) = linear_interp(var_beg(k),var_end(k),delta_t_fraction);
+    });
+    team.team_barrier();
+
+    vert_interp.lin_interp(team, ekat::subview(p_src,icol), ekat::subview(p_tgt,icol),
+                           var_tmp, var_out, icol);
+  });
+  Kokkos::fence();
 }
 
 /*-----------------------------------------------------------------*/
@@ -456,13 +538,25 @@ void SPAFunctions<S,D>
     AbstractRemapper&                 spa_horiz_interp,
     SPAInput&                         spa_input)
 {
-  using namespace ShortFieldTagsNames;
-  using ESU = ekat::ExeSpaceUtils<typename DefaultDevice::execution_space>;
-  using Member = typename KokkosTypes<DefaultDevice>::MemberType;
-
   start_timer("EAMxx::SPA::update_spa_data_from_file");
 
   // 1. Read from file
+  read_spa_data_from_file(scorpio_reader,iop_reader,ts,time_index);
+
+  // 2-3. Remap and pad
+  remap_spa_data(spa_horiz_interp,spa_input);
+
+  stop_timer("EAMxx::SPA::update_spa_data_from_file");
+} // END update_spa_data_from_file
+
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::read_spa_data_from_file(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    const int                         time_index) // zero-based
+{
   start_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
   if (iop_reader) {
     iop_reader->read_variables(time_index, ts);
@@ -470,6 +564,17 @@ void SPAFunctions<S,D>
     scorpio_reader->read_variables(time_index);
   }
   stop_timer("EAMxx::SPA::update_spa_data_from_file::read_data");
+} // END read_spa_data_from_file
+
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::remap_spa_data(
+    AbstractRemapper&                 spa_horiz_interp,
+    SPAInput&                         spa_input)
+{
+  using namespace ShortFieldTagsNames;
+  using ESU = ekat::ExeSpaceUtils<typename DefaultDevice::execution_space>;
+  using Member = typename KokkosTypes<DefaultDevice>::MemberType;
 
   // 2. Run the horiz remapper (it is a do-nothing op if spa data is on same grid as model)
   start_timer("EAMxx::SPA::update_spa_data_from_file::horiz_remap");
@@ -545,9 +650,7 @@ void SPAFunctions<S,D>
   Kokkos::parallel_for("", policy, copy_and_pad);
   Kokkos::fence();
   stop_timer("EAMxx::SPA::update_spa_data_from_file::copy_and_pad");
-
-  stop_timer("EAMxx::SPA::update_spa_data_from_file");
-} // END update_spa_data_from_file
+} // END remap_spa_data
 
 /*-----------------------------------------------------------------*/
 template<typename S, typename D>
@@ -585,6 +688,55 @@ void SPAFunctions<S,D>
 
 } // END updata_spa_timestate
 
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_timestate(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    AbstractRemapper&                 spa_horiz_interp,
+    SPATimeState&                     time_state,
+    SPAInput&                         spa_beg,
+    SPAInput&                         spa_end,
+    SPAInput&                         spa_next,
+    SPAPrefetchState&                 prefetch_state)
+{
+  const auto month = ts.get_month() - 1; // Make it 0-based
+  if (month != time_state.current_month) {
+    const int next_month = (month + 1) % 12;
+    if (prefetch_state.month==next_month) {
+      // Same as the other overload, but the new spa_end is already loaded
+      time_state.current_month = month;
+      time_state.t_beg_month = util::TimeStamp({ts.get_year(),month+1,1}, {0,0,0}).frac_of_year_in_days();
+      time_state.days_this_month = util::days_in_month(ts.get_year(),month+1);
+
+      std::swap(spa_beg,spa_end);
+      std::swap(spa_end,spa_next);
+    } else {
+      // Nothing was prefetched (e.g., first step, or a month shorter than two
+      // time steps), so read the data now.
+      update_spa_timestate(scorpio_reader,iop_reader,ts,spa_horiz_interp,time_state,spa_beg,spa_end);
+    }
+    prefetch_state = SPAPrefetchState();
+    return;
+  }
+
+  // Load the month after spa_end in two stages, on two separate steps, so that
+  // no single step pays for both the file read and the horiz remap.
+  // NOTE: scorpio and the remappers perform MPI collectives, so this cannot
+  //       be done on a separate thread.
+  const int prefetch_month = (month + 2) % 12;
+  if (prefetch_state.month==prefetch_month) {
+    return;
+  } else if (prefetch_state.month_read!=prefetch_month) {
+    read_spa_data_from_file(scorpio_reader,iop_reader,ts,prefetch_month);
+    prefetch_state.month_read = prefetch_month;
+  } else {
+    remap_spa_data(spa_horiz_interp,spa_next);
+    prefetch_state.month = prefetch_month;
+  }
+} // END updata_spa_timestate
+
 template<typename S,typename D>
 KOKKOS_INLINE_FUNCTION
 auto SPAFunctions<S,D>::
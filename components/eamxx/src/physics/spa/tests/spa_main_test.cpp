@@ -10,6 +10,7 @@
 #include "ekat/util/ekat_test_utils.hpp"
 #include "ekat/ekat_pack.hpp"
 
+#include <limits>
 #include <random>
 
 namespace {
@@ -346,7 +347,58 @@ TEST_CASE("spa_main")
       check_bounds (sv(data_beg_h.aer_tau_lw,i,n),sv(data_out_h.aer_tau_lw,i,n));
     }
   }
-  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
+  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n";
+
+  // ======================================================== //
+  //                Test spa_main                             //
+  // ======================================================== //
+
+  // spa_main fuses time interpolation, source pressure computation and vertical
+  // interpolation; it must match calling the three stages one after the other
+  std::cout << "  -> spa_main, fused vs staged interp\n";
+
+  // Padded hybrid coords, so that p_src spans (and exceeds) the p_tgt range
+  for (auto data : {spa_beg, spa_end}) {
+    auto hyam_h = Kokkos::create_mirror_view(ekat::scalarize(data.hyam));
+    auto hybm_h = Kokkos::create_mirror_view(ekat::scalarize(data.hybm));
+    for (int k=0; k<nlevs+2; ++k) {
+      hyam_h(k) = 0;
+      hybm_h(k) = Real(k)/(nlevs+1);
+    }
+    hyam_h(nlevs+1) = 1e5;
+    Kokkos::deep_copy(ekat::scalarize(data.hyam),hyam_h);
+    Kokkos::deep_copy(ekat::scalarize(data.hybm),hybm_h);
+  }
+
+  SPAFunc::SPAOutput spa_out_fused(ncols, nlevs, nswbands, nlwbands);
+  SPADataHost data_out_fused_h(spa_out_fused);
+
+  SPAFunc::spa_main(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_fused);
+  data_out_fused_h.copy_from_dev(spa_out_fused);
+
+  SPAFunc::perform_time_interpolation(spa_time_state,spa_beg,spa_end,spa_tmp);
+  SPAFunc::compute_source_pressure_levels(spa_tmp.PS,p_src,spa_beg.hyam,spa_beg.hybm);
+  SPAFunc::perform_vertical_interpolation(p_src,p_tgt,spa_tmp.data,spa_out);
+  data_out_h.copy_from_dev(spa_out);
+
+  // Both paths perform the same arithmetic, so the results must be BFB
+  auto check_bfb = [&](const Real fused, const Real staged) {
+    REQUIRE (fused==staged);
+  };
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      check_bfb (data_out_fused_h.ccn3(i,k), data_out_h.ccn3(i,k));
+      for (int n=0; n<nswbands; ++n) {
+        check_bfb (data_out_fused_h.aer_g_sw(i,n,k),   data_out_h.aer_g_sw(i,n,k));
+        check_bfb (data_out_fused_h.aer_ssa_sw(i,n,k), data_out_h.aer_ssa_sw(i,n,k));
+        check_bfb (data_out_fused_h.aer_tau_sw(i,n,k), data_out_h.aer_tau_sw(i,n,k));
+      }
+      for (int n=0; n<nlwbands; ++n) {
+        check_bfb (data_out_fused_h.aer_tau_lw(i,n,k), data_out_h.aer_tau_lw(i,n,k));
+      }
+    }
+  }
+  std::cout << "  -> spa_main, fused vs staged interp ..................... OK!\n\n";
 }
 
 // Compute min/max of input over [start,end) indices
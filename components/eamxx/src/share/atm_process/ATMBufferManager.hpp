@@ -2,6 +2,7 @@
 #define SCREAM_ATM_BUFFERS_MANAGER_HPP
 
 #include "share/scream_types.hpp"
+#include "share/util/eamxx_numa_utils.hpp"
 #include "ekat/ekat_assert.hpp"
 
 namespace scream {
@@ -40,7 +41,10 @@ struct ATMBufferManager {
   void allocate () {
     ekat::error::runtime_check(!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
-    m_buffer = view_1d<Real>("",m_size);
+    // Each process carves per-column workspaces out of this buffer, so split the
+    // zero-fill among all threads, to spread the pages across NUMA nodes
+    m_buffer = view_1d<Real>(Kokkos::view_alloc("",Kokkos::WithoutInitializing),m_size);
+    first_touch_zero(m_buffer,DefaultDevice::execution_space().concurrency());
     m_allocated = true;
   }
 
@@ -2,9 +2,11 @@
 #include "share/util/scream_timing.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_lincomb.hpp"
 
 #include "ekat/ekat_assert.hpp"
 
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -87,9 +89,14 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 }
 
 void AtmosphereProcess::run (const double dt) {
-  m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
-  start_timer (m_timer_prefix + this->name() + "::run");
-  if (m_params.get("enable_precondition_checks", true)) {
+  if (not m_run_hooks_ready) {
+    setup_run_hooks();
+  }
+
+  const auto run_start = std::chrono::steady_clock::now();
+  m_atm_logger->debug(m_run_log_msg);
+  start_timer (m_run_timer_name);
+  if (m_do_precondition_checks) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
   }
@@ -100,9 +107,10 @@ void AtmosphereProcess::run (const double dt) {
   // Init single step tendencies (if any) with current value of output field
   init_step_tendencies ();
 
+  const bool do_conservation_check = has_column_conservation_check();
   for (m_subcycle_iter=0; m_subcycle_iter<m_num_subcycles; ++m_subcycle_iter) {
 
-    if (has_column_conservation_check()) {
+    if (do_conservation_check) {
       // Column local mass and energy checks requires the total mass and energy
       // to be computed directly before the atm process is run, as well and store
       // the correct timestep for the process.
@@ -114,13 +122,16 @@ void AtmosphereProcess::run (const double dt) {
                               true, false, false);
 
     // Run derived class implementation
+    const auto impl_start = std::chrono::steady_clock::now();
     run_impl(dt_sub);
+    const auto impl_stop = std::chrono::steady_clock::now();
+    m_run_impl_time += std::chrono::duration<double>(impl_stop-impl_start).count();
 
     if (m_internal_diagnostics_level > 0)
       print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
                               true, true, true);
 
-    if (has_column_conservation_check()) {
+    if (do_conservation_check) {
       // Run the column local mass and energy conservation checks
       run_column_conservation_check();
     }
@@ -129,7 +140,7 @@ void AtmosphereProcess::run (const double dt) {
   // Complete tendency calculations (if any)
   compute_step_tendencies(dt);
 
-  if (m_params.get("enable_postcondition_checks", true)) {
+  if (m_do_postcondition_checks) {
     // Run 'post-condition' property checks stored in this AP
     run_postcondition_checks();
   }
@@ -139,11 +150,78 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  stop_timer (m_run_timer_name);
+  const auto run_stop = std::chrono::steady_clock::now();
+  m_run_time += std::chrono::duration<double>(run_stop-run_start).count();
+}
+
+void AtmosphereProcess::setup_run_hooks () {
+  // Empty check lists are skipped altogether, rather than paying for
+  // the timers and log messages of a no-op loop at every step
+  m_do_precondition_checks  = m_params.get("enable_precondition_checks", true) &&
+                              m_precondition_checks.size()>0;
+  m_do_postcondition_checks = m_params.get("enable_postcondition_checks", true) &&
+                              m_postcondition_checks.size()>0;
+
+  m_run_timer_name = m_timer_prefix + this->name() + "::run";
+  m_run_log_msg    = "[EAMxx::" + this->name() + "] run...";
+
+  // Resolve tendency names once, so each step does no map lookups
+  m_tendency_hooks.clear();
+  for (const auto& it : m_proc_tendencies) {
+    const auto& fname = m_tend_to_field.at(it.first);
+    m_tendency_hooks.push_back({get_field_out(fname),
+                                m_start_of_step_fields.at(fname),
+                                it.second});
+  }
+
+  // Gather the trackings of all output fields/groups. Updating a tracking
+  // also updates all its children, so skip those whose ancestor is in the list.
+  std::set<const FieldTracking*> all_trackings;
+  std::vector<std::shared_ptr<FieldTracking>> trackings;
+  auto add_tracking = [&](const Field& f) {
+    const auto& t = f.get_header().get_tracking_ptr();
+    if (all_trackings.insert(t.get()).second) {
+      trackings.push_back(t);
+    }
+  };
+  for (const auto& f : m_fields_out) {
+    add_tracking(f);
+  }
+  for (const auto& g : m_groups_out) {
+    if (g.m_bundle) {
+      add_tracking(*g.m_bundle);
+    } else {
+      for (const auto& f : g.m_fields) {
+        add_tracking(*f.second);
+      }
+    }
+  }
+  m_out_fields_trackings.clear();
+  for (const auto& t : trackings) {
+    bool ancestor_found = false;
+    for (auto p = t->get_parent().lock(); p!=nullptr; p = p->get_parent().lock()) {
+      if (all_trackings.count(p.get())==1) {
+        ancestor_found = true;
+        break;
+      }
+    }
+    if (not ancestor_found) {
+      m_out_fields_trackings.push_back(t);
+    }
+  }
+
+  m_run_hooks_ready = true;
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
   finalize_impl(/* what inputs? */);
+
+  if (this->type()!=AtmosphereProcessType::Group && m_run_time>0) {
+    m_atm_logger->info("[EAMxx::" + this->name() + "] run time (s): "
+                       + std::to_string(m_run_impl_time) + " in run_impl, "
+                       + std::to_string(get_framework_overhead_time()) + " in framework overhead.");
+  }
 }
 
 void AtmosphereProcess::setup_tendencies_requests () {
@@ -495,11 +573,8 @@ void AtmosphereProcess::run_column_conservation_check () const {
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
-    for (auto& it : m_start_of_step_fields) {
-      const auto& fname = it.first;
-      const auto& f     = get_field_out(fname);
-            auto& f_beg = it.second;
-      f_beg.deep_copy(f);
+    for (auto& h : m_tendency_hooks) {
+      h.f_beg.deep_copy(h.f);
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
@@ -510,17 +585,11 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
-    for (auto it : m_proc_tendencies) {
-      // Note: f_beg is nonconst, so we can store step tendency in it
-      const auto& tname = it.first;
-      const auto& fname = m_tend_to_field.at(tname);
-      const auto& f     = get_field_out(fname);
-            auto& f_beg = m_start_of_step_fields.at(fname);
-            auto& tend  = it.second;
-
-      // Compute tend from this atm proc step, then sum into overall atm timestep tendency
-      f_beg.update(f,1,-1);
-      tend.update(f_beg,1,1);
+    for (auto& h : m_tendency_hooks) {
+      // Compute tend from this atm proc step, and sum it into overall atm timestep tendency.
+      // Note: evaluate forms f-f_beg before adding it to tend, so this is BFB with
+      //       the two-step computation f_beg=f-f_beg, tend+=f_beg.
+      evaluate(h.tend, Real(1)*h.f - Real(1)*h.f_beg, Real(1));
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
@@ -584,17 +653,11 @@ void AtmosphereProcess::update_time_stamps () {
   // Update *all* output fields/groups, regardless of whether
   // they were touched at all during this time step.
   // TODO: this might have to be changed
-  for (auto& f : m_fields_out) {
-    f.get_header().get_tracking().update_time_stamp(t);
+  if (not m_run_hooks_ready) {
+    setup_run_hooks();
   }
-  for (auto& g : m_groups_out) {
-    if (g.m_bundle) {
-      g.m_bundle->get_header().get_tracking().update_time_stamp(t);
-    } else {
-      for (auto& f : g.m_fields) {
-        f.second->get_header().get_tracking().update_time_stamp(t);
-      }
-    }
+  for (auto& tracking : m_out_fields_trackings) {
+    tracking->update_time_stamp(t);
   }
 }
 
@@ -733,6 +796,7 @@ add_precondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_precondition_checks.push_back(std::make_pair(cfh,pc));
+  m_run_hooks_ready = false;
 }
 
 void AtmosphereProcess::
@@ -780,6 +844,7 @@ add_postcondition_check (const prop_check_ptr& pc, const CheckFailHandling cfh)
         "  - Property check name: " + pc->name() + "\n");
   }
   m_postcondition_checks.push_back(std::make_pair(cfh,pc));
+  m_run_hooks_ready = false;
 }
 
 void AtmosphereProcess::
@@ -790,6 +855,7 @@ add_column_conservation_check(const prop_check_ptr &prop_check, const CheckFailH
                    "\" has already been added.");
 
   m_column_conservation_check = std::make_pair(cfh,prop_check);
+  m_run_hooks_ready = false;
 }
 
 void AtmosphereProcess::set_fields_and_groups_pointers () {
@@ -213,6 +213,12 @@ public:
         "   - Atm proc name: " + this->name() + "\n");
   }
 
+  // Processes that hand part of their work to a host thread (and therefore may
+  // return from run before their outputs are ready) must override this method,
+  // waiting for such work and publishing the outputs in the field manager.
+  // The AD calls this at the end of each atm step, before running the output managers.
+  virtual void finish_pending_work () {}
+
   // Convenience function to retrieve input/output fields from the field/group (and grid) name.
   // Note: the version without grid name only works if there is only one copy of the field/group.
   //       In that case, the single copy is returned, regardless of the associated grid name.
@@ -287,6 +293,15 @@ public:
     return m_atm_logger;
   }
 
+  // Host wall time (in seconds) accumulated over all calls to run. The run_impl
+  // time is the time spent in the derived class; the framework overhead is
+  // everything else done by run (checks, tendencies, time stamps, hashing).
+  // Note: kernels launched asynchronously by run_impl may complete outside
+  //       of the run_impl timing window.
+  double get_run_time () const { return m_run_time; }
+  double get_run_impl_time () const { return m_run_impl_time; }
+  double get_framework_overhead_time () const { return m_run_time - m_run_impl_time; }
+
 protected:
 
   // Sends a message to the atm log
@@ -515,6 +530,12 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Precompute everything the run method needs at each call: which hooks
+  // are active, timer/log strings, tendency field triplets, and the minimal
+  // set of output field trackings whose time stamps must be updated.
+  // Called at the first run, and again if property checks are added later.
+  void setup_run_hooks ();
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -587,6 +608,24 @@ private:
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Per-process run hooks, precomputed by setup_run_hooks
+  struct TendencyHook {
+    Field f;      // The updated field
+    Field f_beg;  // Copy of f at the beginning of the step
+    Field tend;   // The tendency field
+  };
+  bool m_run_hooks_ready = false;
+  bool m_do_precondition_checks;
+  bool m_do_postcondition_checks;
+  std::string m_run_timer_name;
+  std::string m_run_log_msg;
+  std::vector<TendencyHook> m_tendency_hooks;
+  std::vector<std::shared_ptr<FieldTracking>> m_out_fields_trackings;
+
+  // Accumulated host wall time in run and in run_impl
+  double m_run_time      = 0;
+  double m_run_impl_time = 0;
+
 protected:
 
   // IOP object
@@ -1,7 +1,11 @@
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/atm_process/atmosphere_process_group.hpp"
 
+#include "ekat/ekat_parse_yaml_file.hpp"
+
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
 
 namespace scream {
 
@@ -13,6 +17,9 @@ create_dag(const group_type& atm_procs)
   // Create the nodes
   add_nodes(atm_procs);
 
+  // At this point, m_nodes only contains the atm processes, in the order they run
+  build_execution_plan();
+
   // Add a 'begin' and 'end' placeholders. While they are not actual
   // nodes of the graph, they come handy when representing inputs
   // coming from previous time step, or output that will be fed to
@@ -341,6 +348,9 @@ void AtmProcDAG::cleanup () {
   m_fid_to_last_provider.clear();
   m_unmet_deps.clear();
   m_has_unmet_deps = false;
+  m_plan.clear();
+  m_num_levels = 0;
+  m_critical_path_cost = -1;
 }
 
 void AtmProcDAG::
@@ -370,6 +380,7 @@ add_nodes (const group_type& atm_procs)
       Node& node = m_nodes.back();;
       node.id = id;
       node.name = proc->name();
+      node.proc = proc;
       m_unmet_deps[id].clear(); // Ensures an entry for this id is in the map
 
       // Input fields
@@ -475,7 +486,7 @@ void AtmProcDAG::add_edges () {
       int i=0;
       for (auto f_it : group.m_fields) {
         const auto& fid = f_it.second->get_header().get_identifier();
-        auto fid_id = std::find(m_fids.begin(),m_fids.end(),fid) - m_fids.begin();
+        auto fid_id = get_fid_index(fid);
         it = m_fid_to_last_provider.find(fid_id);
         // Note: check that last provider id is SMALLER than this node id
         if (it!=m_fid_to_last_provider.end() and it->second<node.id) {
@@ -508,21 +519,25 @@ void AtmProcDAG::add_edges () {
 }
 
 int AtmProcDAG::add_fid (const FieldIdentifier& fid) {
-  auto it = ekat::find(m_fids,fid);
-  if (it==m_fids.end()) {
+  // FieldIdentifier comparison is based on the id string, so use it as key,
+  // to avoid a linear search in m_fids
+  auto it = m_fid_str_to_id.find(fid.get_id_string());
+  if (it==m_fid_str_to_id.end()) {
     m_fids.push_back(fid);
-    return m_fids.size()-1;
+    const int id = m_fids.size()-1;
+    m_fid_str_to_id[fid.get_id_string()] = id;
+    return id;
   } else {
-    return std::distance(m_fids.begin(), it);
+    return it->second;
   }
 }
 
 int AtmProcDAG::get_fid_index (const FieldIdentifier& fid) const {
-  auto it = ekat::find(m_fids,fid);
-  if (it==m_fids.end()) {
+  auto it = m_fid_str_to_id.find(fid.get_id_string());
+  if (it==m_fid_str_to_id.end()) {
     return -1;
   } else {
-    return std::distance(m_fids.cbegin(),it);
+    return it->second;
   }
 }
 
@@ -538,4 +553,206 @@ void AtmProcDAG::update_unmet_deps () {
   }
 }
 
+std::vector<int> AtmProcDAG::expand_groups (const std::set<int>& ids) const {
+  std::set<int> expanded = ids;
+  for (auto id : ids) {
+    auto it = m_gr_fid_to_group.find(m_fids[id]);
+    if (it!=m_gr_fid_to_group.end()) {
+      for (const auto& f_it : it->second.m_fields) {
+        expanded.insert(get_fid_index(f_it.second->get_header().get_identifier()));
+      }
+    }
+  }
+  expanded.erase(-1);
+  return std::vector<int>(expanded.begin(),expanded.end());
+}
+
+void AtmProcDAG::build_execution_plan () {
+  auto intersect = [](const std::vector<int>& a, const std::vector<int>& b) {
+    std::vector<int> c;
+    std::set_intersection(a.begin(),a.end(),b.begin(),b.end(),std::back_inserter(c));
+    return c;
+  };
+
+  const int nprocs = m_nodes.size();
+  m_plan.resize(nprocs);
+  m_num_levels = 0;
+
+  // Last entry writing each field, as we sweep the plan
+  std::map<int,int> last_writer;
+  for (int i=0; i<nprocs; ++i) {
+    const auto& node = m_nodes[i];
+    auto& e = m_plan[i];
+    e.name = node.name;
+
+    std::set<int> reads (node.required.begin(),node.required.end());
+    reads.insert(node.gr_required.begin(),node.gr_required.end());
+    std::set<int> writes (node.computed.begin(),node.computed.end());
+    writes.insert(node.gr_computed.begin(),node.gr_computed.end());
+    e.reads  = expand_groups(reads);
+    e.writes = expand_groups(writes);
+
+    // Since the plan must give the same results as the sequential run,
+    // an entry must wait for any earlier entry that writes what it reads (RAW),
+    // reads what it writes (WAR), or writes what it writes (WAW).
+    e.level = 0;
+    for (int j=0; j<i; ++j) {
+      const auto& p = m_plan[j];
+      if (intersect(p.writes,e.reads).size()>0 or
+          intersect(p.reads,e.writes).size()>0 or
+          intersect(p.writes,e.writes).size()>0) {
+        e.depends_on.push_back(j);
+        e.level = std::max(e.level,p.level+1);
+      }
+    }
+    m_num_levels = std::max(m_num_levels,e.level+1);
+
+    // An input can be prefetched while the previous level runs if its last
+    // writer (if any) belongs to an even earlier level
+    for (auto id : e.reads) {
+      auto it = last_writer.find(id);
+      if (e.level>0 and (it==last_writer.end() or m_plan[it->second].level<e.level-1)) {
+        e.prefetch.push_back(id);
+      }
+    }
+    for (auto id : e.writes) {
+      last_writer[id] = i;
+    }
+  }
+}
+
+std::vector<std::vector<int>> AtmProcDAG::get_concurrent_sets () const {
+  std::vector<std::vector<int>> sets(m_num_levels);
+  for (int i=0; i<static_cast<int>(m_plan.size()); ++i) {
+    sets[m_plan[i].level].push_back(i);
+  }
+  return sets;
+}
+
+void AtmProcDAG::set_costs (const std::map<std::string,double>& costs) {
+  bool all_known = m_plan.size()>0;
+  for (auto& e : m_plan) {
+    auto it = costs.find(e.name);
+    e.cost = it==costs.end() ? -1 : it->second;
+    e.finish = -1;
+    e.on_critical_path = false;
+    all_known &= e.cost>=0;
+  }
+
+  m_critical_path_cost = -1;
+  if (not all_known) {
+    return;
+  }
+
+  // Earliest finish time of each entry, assuming unlimited concurrency
+  int last = -1;
+  for (int i=0; i<static_cast<int>(m_plan.size()); ++i) {
+    auto& e = m_plan[i];
+    double start = 0;
+    for (auto j : e.depends_on) {
+      start = std::max(start,m_plan[j].finish);
+    }
+    e.finish = start + e.cost;
+    if (last==-1 or e.finish>m_plan[last].finish) {
+      last = i;
+    }
+  }
+  m_critical_path_cost = m_plan[last].finish;
+
+  // Walk back along the dependencies that determined the start time
+  while (last>=0) {
+    auto& e = m_plan[last];
+    e.on_critical_path = true;
+    int prev = -1;
+    for (auto j : e.depends_on) {
+      if (prev==-1 or m_plan[j].finish>m_plan[prev].finish) {
+        prev = j;
+      }
+    }
+    last = prev;
+  }
+}
+
+std::map<std::string,double> AtmProcDAG::measure_costs (const int nsteps) const {
+  std::map<std::string,double> costs;
+  if (nsteps<=0) {
+    return costs;
+  }
+  for (int i=0; i<static_cast<int>(m_plan.size()); ++i) {
+    // Processes appearing multiple times in the plan share the same name (and cost)
+    costs[m_plan[i].name] = m_nodes[i].proc->get_run_time() / nsteps;
+  }
+  return costs;
+}
+
+void AtmProcDAG::write_schedule (const std::string& fname) const {
+  auto fid_names = [&](const std::vector<int>& ids) {
+    std::string s;
+    for (auto id : ids) {
+      s += (s.size()>0 ? ", " : "");
+      s += "\"" + m_fids[id].name() + " [" + m_fids[id].get_grid_name() + "]\"";
+    }
+    return s;
+  };
+
+  std::ofstream ofile (fname.c_str());
+  // Always print a decimal point, so that costs are parsed as doubles
+  ofile << std::fixed << std::setprecision(9);
+  ofile << "%YAML 1.1\n"
+        << "---\n"
+        << "# Execution plan of the atm processes. Processes with the same level\n"
+        << "# have no data hazards among them, and could run concurrently.\n"
+        << "# Costs are in seconds per atm step, from the previous run (-1 if unknown).\n"
+        << "atmosphere_schedule:\n"
+        << "  num_processes: " << m_plan.size() << "\n"
+        << "  num_levels: " << m_num_levels << "\n"
+        << "  critical_path_cost: " << m_critical_path_cost << "\n"
+        << "  processes:\n";
+  for (int i=0; i<static_cast<int>(m_plan.size()); ++i) {
+    const auto& e = m_plan[i];
+    ofile << "    \"" << e.name << "\":\n"
+          << "      order: " << i << "\n"
+          << "      level: " << e.level << "\n"
+          << "      cost: " << e.cost << "\n"
+          << "      on_critical_path: " << (e.on_critical_path ? "true" : "false") << "\n";
+    // Empty lists are omitted, since their type could not be deduced when parsing
+    if (e.depends_on.size()>0) {
+      std::string deps;
+      for (auto j : e.depends_on) {
+        deps += (deps.size()>0 ? ", " : "");
+        deps += "\"" + m_plan[j].name + "\"";
+      }
+      ofile << "      depends_on: [" << deps << "]\n";
+    }
+    if (e.reads.size()>0) {
+      ofile << "      reads: [" << fid_names(e.reads) << "]\n";
+    }
+    if (e.writes.size()>0) {
+      ofile << "      writes: [" << fid_names(e.writes) << "]\n";
+    }
+    if (e.prefetch.size()>0) {
+      ofile << "      prefetch: [" << fid_names(e.prefetch) << "]\n";
+    }
+  }
+  ofile.close();
+}
+
+std::map<std::string,double> AtmProcDAG::read_schedule_costs (const std::string& fname) {
+  std::map<std::string,double> costs;
+  if (not std::ifstream(fname).good()) {
+    return costs;
+  }
+
+  ekat::ParameterList params;
+  ekat::parse_yaml_file(fname,params);
+  auto& procs = params.sublist("atmosphere_schedule").sublist("processes");
+  for (auto it=procs.sublists_names_cbegin(); it!=procs.sublists_names_cend(); ++it) {
+    const auto cost = procs.sublist(*it).get<double>("cost",-1);
+    if (cost>=0) {
+      costs[*it] = cost;
+    }
+  }
+  return costs;
+}
+
 } // namespace scream
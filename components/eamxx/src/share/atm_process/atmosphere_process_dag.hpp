@@ -1,8 +1,10 @@
 #ifndef SCREAM_ATMOSPHERE_PROCESS_DAG_HPP
 #define SCREAM_ATMOSPHERE_PROCESS_DAG_HPP
 
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/field/field_group.hpp"
 
@@ -14,6 +16,20 @@ public:
   using group_type = AtmosphereProcessGroup;
   static constexpr int VERB_MAX = 4;
 
+  // One entry of the execution plan, for each (non-group) atm process, in the
+  // order they are run. Field (and bundled group) ids index get_fids().
+  struct PlanEntry {
+    std::string       name;
+    std::vector<int>  reads;        // sorted ids of input fields (group members included)
+    std::vector<int>  writes;       // sorted ids of output fields (group members included)
+    std::vector<int>  depends_on;   // earlier entries with a RAW/WAR/WAW hazard on some field
+    std::vector<int>  prefetch;     // inputs already final before the previous level starts
+    int               level = 0;    // entries with the same level have no hazards among them
+    double            cost = -1;    // time per step (s), if known (e.g., from a previous run)
+    double            finish = -1;  // earliest finish time along the dag (needs all costs)
+    bool              on_critical_path = false;
+  };
+
   void create_dag (const group_type& atm_procs);
 
   void add_surface_coupling (const std::set<FieldIdentifier>& imports,
@@ -26,6 +42,27 @@ public:
     return m_unmet_deps;
   }
 
+  // The execution plan, computed by create_dag
+  const std::vector<PlanEntry>& get_execution_plan () const { return m_plan; }
+  const std::vector<FieldIdentifier>& get_fids () const { return m_fids; }
+  int get_num_levels () const { return m_num_levels; }
+
+  // Entries of the plan that can run concurrently, grouped by level
+  std::vector<std::vector<int>> get_concurrent_sets () const;
+
+  // Set the cost (time per step) of each process, and compute the critical path.
+  // Processes not in the map keep an unknown cost, and disable the critical path.
+  void set_costs (const std::map<std::string,double>& costs);
+  double get_critical_path_cost () const { return m_critical_path_cost; }
+
+  // The run time per step of each process in the plan, measured so far in this run
+  std::map<std::string,double> measure_costs (const int nsteps) const;
+
+  // Write the plan (with costs and critical path, if known) as a yaml file,
+  // and read back the costs from such file (empty map if the file does not exist)
+  void write_schedule (const std::string& fname) const;
+  static std::map<std::string,double> read_schedule_costs (const std::string& fname);
+
 protected:
 
   void cleanup ();
@@ -44,10 +81,16 @@ protected:
 
   void update_unmet_deps ();
 
+  void build_execution_plan ();
+
+  // Add the ids of the members of any bundled group in ids
+  std::vector<int> expand_groups (const std::set<int>& ids) const;
+
   struct Node {
     std::vector<int>  children;
     std::string       name;
     int               id;
+    std::shared_ptr<const AtmosphereProcess> proc;  // null for placeholders
     std::set<int>     computed;     // output fields
     std::set<int>     required;     // input  fields
     std::set<int>     gr_computed;  // output groups
@@ -56,6 +99,7 @@ protected:
 
   // Assign an id to each field identifier
   std::vector<FieldIdentifier>            m_fids;
+  std::map<std::string,int>               m_fid_str_to_id;
 
   // Store groups so we can print info of their members if need be
   std::map<FieldIdentifier,FieldGroup>    m_gr_fid_to_group;
@@ -69,6 +113,11 @@ protected:
 
   // The nodes in the atm DAG
   std::vector<Node>               m_nodes;
+
+  // The execution plan (one entry per atm process node)
+  std::vector<PlanEntry>          m_plan;
+  int                             m_num_levels = 0;
+  double                          m_critical_path_cost = -1;
 };
 
 } // namespace scream
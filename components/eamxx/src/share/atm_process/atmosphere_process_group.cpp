@@ -407,6 +407,12 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
+void AtmosphereProcessGroup::finish_pending_work () {
+  for (auto atm_proc : m_atm_processes) {
+    atm_proc->finish_pending_work();
+  }
+}
+
 void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
   EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
 }
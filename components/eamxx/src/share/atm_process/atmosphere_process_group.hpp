@@ -75,6 +75,9 @@ public:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager& buffer_manager);
 
+  // Wait for any pending work in the stored processes
+  void finish_pending_work ();
+
   // The APG class needs to perform special checks before establishing whether
   // a required group/field is indeed a required group for this APG
   void set_required_field (const Field& field);
@@ -1,5 +1,6 @@
 #include "share/field/field.hpp"
 #include "share/util/scream_utils.hpp"
+#include "share/util/eamxx_numa_utils.hpp"
 
 namespace scream
 {
@@ -222,7 +223,10 @@ void Field::allocate_view ()
   // Create the view, by quering allocation properties for the allocation size
   const auto view_dim = alloc_prop.get_alloc_size();
 
-  m_data.d_view = decltype(m_data.d_view)(id.name(),view_dim);
+  // Zero the view one outermost slice (typically, one column) at a time, so that on
+  // host-threaded builds pages are first touched by the threads that will work on them
+  m_data.d_view = decltype(m_data.d_view)(Kokkos::view_alloc(id.name(),Kokkos::WithoutInitializing),view_dim);
+  first_touch_zero(m_data.d_view, layout.rank()>0 ? layout.dim(0) : 1);
   m_data.h_view = Kokkos::create_mirror_view(m_data.d_view);
 }
 
@@ -0,0 +1,393 @@
+#ifndef SCREAM_FIELD_LINCOMB_HPP
+#define SCREAM_FIELD_LINCOMB_HPP
+
+#include "share/field/field.hpp"
+#include "share/field/field_group.hpp"
+#include "share/util/scream_combine_ops.hpp"
+#include "share/util/scream_universal_constants.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A lazy linear combination of fields, c_0*f_0 + c_1*f_1 + ...
+ *
+ * Expressions are built with the usual arithmetic operators, e.g.
+ *
+ *   auto e = w0*f0 + w1*f1;
+ *
+ * Nothing is computed until the expression is evaluated into a field:
+ *
+ *   evaluate(y,e);       // y = w0*f0 + w1*f1
+ *   evaluate(y,e,beta);  // y = beta*y + (w0*f0 + w1*f1)
+ *
+ * Evaluation launches a single kernel, regardless of the number of terms,
+ * rather than one kernel (and one pass over memory) per deep_copy/update.
+ * Fill values are handled like in Field::update: if any input entry
+ * (including y, if beta is passed) is equal to the fill value, the output
+ * is set to the fill value. The fill value is the "mask_value" extra data
+ * of the first term that has one (or of y), and the default fill value otherwise.
+ * The fields must all have the same layout and data type, but they can be
+ * subfields (possibly strided) of other fields.
+ */
+
+template<typename ST>
+struct FieldLinComb {
+  static constexpr int MaxTerms = 4;
+
+  void add_term (const Field& f, const ST c) {
+    EKAT_REQUIRE_MSG (num_terms<MaxTerms,
+        "Error! Too many terms in field linear combination.\n"
+        " - max terms: " + std::to_string(MaxTerms) + "\n");
+    fields[num_terms] = f;
+    coeffs[num_terms] = c;
+    ++num_terms;
+  }
+
+  int   num_terms = 0;
+  Field fields[MaxTerms];
+  ST    coeffs[MaxTerms];
+};
+
+template<typename ST>
+using if_arithmetic_t = typename std::enable_if<std::is_arithmetic<ST>::value,FieldLinComb<ST>>::type;
+
+template<typename ST>
+if_arithmetic_t<ST> operator* (const ST c, const Field& f) {
+  FieldLinComb<ST> e;
+  e.add_term(f,c);
+  return e;
+}
+
+template<typename ST>
+if_arithmetic_t<ST> operator* (const Field& f, const ST c) {
+  return c*f;
+}
+
+template<typename ST>
+if_arithmetic_t<ST> operator/ (const Field& f, const ST c) {
+  return (ST(1)/c)*f;
+}
+
+template<typename ST>
+if_arithmetic_t<ST> operator* (const ST c, FieldLinComb<ST> e) {
+  for (int i=0; i<e.num_terms; ++i) {
+    e.coeffs[i] *= c;
+  }
+  return e;
+}
+
+template<typename ST>
+FieldLinComb<ST> operator+ (FieldLinComb<ST> lhs, const FieldLinComb<ST>& rhs) {
+  for (int i=0; i<rhs.num_terms; ++i) {
+    lhs.add_term(rhs.fields[i],rhs.coeffs[i]);
+  }
+  return lhs;
+}
+
+template<typename ST>
+FieldLinComb<ST> operator- (FieldLinComb<ST> lhs, const FieldLinComb<ST>& rhs) {
+  for (int i=0; i<rhs.num_terms; ++i) {
+    lhs.add_term(rhs.fields[i],-rhs.coeffs[i]);
+  }
+  return lhs;
+}
+
+template<typename ST>
+FieldLinComb<ST> operator+ (const FieldLinComb<ST>& lhs, const Field& f) {
+  return lhs + ST(1)*f;
+}
+
+template<typename ST>
+FieldLinComb<ST> operator- (const FieldLinComb<ST>& lhs, const Field& f) {
+  return lhs - ST(1)*f;
+}
+
+namespace impl {
+
+// Device-friendly storage for the terms of a linear combination
+template<typename ViewT, typename ST, int N>
+struct LinCombTerms {
+  ViewT v[N];
+  ST    c[N];
+};
+
+// A field stored as a (nrows,ncols) array, with rows padded to stride entries
+template<typename ST>
+struct FieldSlab {
+  ST* data;
+  int ncols;
+  int stride;
+  int offset;   // Index of the first entry of this field in the batch
+  ST  fill_val;
+};
+
+// Kernel for y = beta*y + sum_i c_i*x_i. The views can have any rank,
+// since View::access ignores the trailing (zero) indices.
+// Note: the x terms are summed first, and beta*y is added last. This matches
+// a chain of Field::update calls that accumulates a combination into y, e.g.
+// y += (x0 - x1), and avoids cancellation when x0-x1 is small compared to x0.
+template<typename ExecSpace, typename ST, typename XView, typename YView, int N, typename ExtentsT>
+void lincomb_kernel (const XView (&x)[N], const ST (&c)[N], const int num_terms,
+                     const YView& y, const ST beta, const bool use_y, const ST fill_val,
+                     const ExtentsT& ext, const int rank, const int size)
+{
+  using RangePolicy = Kokkos::RangePolicy<ExecSpace>;
+
+  // Copy to a struct that can be captured by value in the lambda
+  LinCombTerms<XView,ST,N> terms;
+  for (int i=0; i<num_terms; ++i) {
+    terms.v[i] = x[i];
+    terms.c[i] = c[i];
+  }
+
+  Kokkos::parallel_for(RangePolicy(0,size), KOKKOS_LAMBDA(const int idx) {
+    int ii[6] = {0,0,0,0,0,0};
+    int rem = idx;
+    for (int d=rank-1; d>=0; --d) {
+      ii[d] = rem % ext(d);
+      rem  /= ext(d);
+    }
+
+    auto& yv = y.access(ii[0],ii[1],ii[2],ii[3],ii[4],ii[5]);
+    ST result = ST(0);
+    bool masked = false;
+    for (int t=0; t<num_terms; ++t) {
+      const ST xv = terms.v[t].access(ii[0],ii[1],ii[2],ii[3],ii[4],ii[5]);
+      masked |= xv==fill_val;
+      result += terms.c[t]*xv;
+    }
+    if (use_y) {
+      masked |= yv==fill_val;
+      result += beta*yv;
+    }
+    yv = masked ? fill_val : result;
+  });
+}
+
+template<HostOrDevice HD, typename ST, int N>
+void evaluate_rank (const Field& y, const FieldLinComb<ST>& e, const ST beta,
+                    const bool use_y, const ST fill_val)
+{
+  using device_t   = typename Field::get_device<HD>;
+  using exec_space = typename device_t::execution_space;
+  using data_t     = Field::data_nd_t<ST,N>;
+  using cdata_t    = Field::data_nd_t<const ST,N>;
+  constexpr int MaxTerms = FieldLinComb<ST>::MaxTerms;
+
+  const auto& layout = y.get_header().get_identifier().get_layout();
+  using extents_type = typename ekat::KokkosTypes<device_t>::template view_1d<int>;
+  extents_type ext ("",std::max(layout.rank(),1));
+  Kokkos::deep_copy(Kokkos::subview(ext,std::make_pair(0,layout.rank())),layout.extents());
+
+  // Like in Field::update, rank-1 subfields may not be LayoutRight
+  bool all_contiguous = y.get_header().get_alloc_properties().contiguous();
+  for (int i=0; i<e.num_terms; ++i) {
+    all_contiguous &= e.fields[i].get_header().get_alloc_properties().contiguous();
+  }
+
+  if (N==1 && not all_contiguous) {
+    using xview_t = decltype(y.get_strided_view<const ST*,HD>());
+    xview_t xv[MaxTerms];
+    for (int i=0; i<e.num_terms; ++i) {
+      xv[i] = e.fields[i].get_strided_view<const ST*,HD>();
+    }
+    lincomb_kernel<exec_space>(xv,e.coeffs,e.num_terms,y.get_strided_view<ST*,HD>(),
+                               beta,use_y,fill_val,ext,layout.rank(),layout.size());
+  } else {
+    using xview_t = decltype(y.get_view<cdata_t,HD>());
+    xview_t xv[MaxTerms];
+    for (int i=0; i<e.num_terms; ++i) {
+      xv[i] = e.fields[i].get_view<cdata_t,HD>();
+    }
+    lincomb_kernel<exec_space>(xv,e.coeffs,e.num_terms,y.get_view<data_t,HD>(),
+                               beta,use_y,fill_val,ext,layout.rank(),layout.size());
+  }
+  Kokkos::fence();
+}
+
+template<HostOrDevice HD, typename ST>
+void evaluate_impl (const Field& y, const FieldLinComb<ST>& e, const ST beta, const bool use_y)
+{
+  EKAT_REQUIRE_MSG (y.is_allocated(),
+      "Error! Cannot evaluate expression, since output field is not allocated.\n"
+      " - field name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (not y.is_read_only(),
+      "Error! Cannot evaluate expression, as output field is read-only.\n"
+      " - field name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (e.num_terms>0,
+      "Error! Cannot evaluate an empty expression.\n"
+      " - field name: " + y.name() + "\n");
+
+  const auto dt_y = y.data_type();
+
+  const auto& y_l = y.get_header().get_identifier().get_layout();
+  ST fill_val = constants::DefaultFillValue<ST>().value;
+  bool fill_val_found = false;
+  for (int i=0; i<e.num_terms; ++i) {
+    const auto& x = e.fields[i];
+    EKAT_REQUIRE_MSG (x.is_allocated(),
+        "Error! Cannot evaluate expression, since one of its fields is not allocated.\n"
+        " - field name: " + x.name() + "\n");
+    EKAT_REQUIRE_MSG (x.data_type()==dt_y,
+        "Error! Expression fields and output field must have the same data type.\n"
+        " - x name: " + x.name() + "\n"
+        " - y name: " + y.name() + "\n"
+        " - x data type: " + e2str(x.data_type()) + "\n"
+        " - y data type: " + e2str(dt_y) + "\n");
+    const auto& x_l = x.get_header().get_identifier().get_layout();
+    EKAT_REQUIRE_MSG (x_l==y_l,
+        "Error! Incompatible layouts in expression evaluation.\n"
+        " - x name: " + x.name() + "\n"
+        " - y name: " + y.name() + "\n"
+        " - x layout: " + x_l.to_string() + "\n"
+        " - y layout: " + y_l.to_string() + "\n");
+    if (not fill_val_found && x.get_header().has_extra_data("mask_value")) {
+      fill_val = x.get_header().get_extra_data<ST>("mask_value");
+      fill_val_found = true;
+    }
+  }
+  if (not fill_val_found && y.get_header().has_extra_data("mask_value")) {
+    fill_val = y.get_header().get_extra_data<ST>("mask_value");
+  }
+
+  switch (y_l.rank()) {
+    case 0: evaluate_rank<HD,ST,0>(y,e,beta,use_y,fill_val); break;
+    case 1: evaluate_rank<HD,ST,1>(y,e,beta,use_y,fill_val); break;
+    case 2: evaluate_rank<HD,ST,2>(y,e,beta,use_y,fill_val); break;
+    case 3: evaluate_rank<HD,ST,3>(y,e,beta,use_y,fill_val); break;
+    case 4: evaluate_rank<HD,ST,4>(y,e,beta,use_y,fill_val); break;
+    case 5: evaluate_rank<HD,ST,5>(y,e,beta,use_y,fill_val); break;
+    case 6: evaluate_rank<HD,ST,6>(y,e,beta,use_y,fill_val); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Rank not supported in expression evaluation.\n"
+          " - y name: " + y.name() + "\n");
+  }
+}
+
+// Casts the coefficients to the fields data type, and dispatch
+template<HostOrDevice HD, typename ST>
+void evaluate (const Field& y, const FieldLinComb<ST>& e, const ST beta, const bool use_y)
+{
+  // Like in Field::update, do not allow coefficients to be narrowed when cast
+  const auto dt = y.data_type();
+  const auto dt_st = get_data_type<ST>();
+  EKAT_REQUIRE_MSG (not is_narrowing_conversion(dt_st,dt),
+      "Error! Expression coefficients may be narrowed when converted to the field data type.\n"
+      " - field data type: " + e2str(dt) + "\n"
+      " - coeff data type: " + e2str(dt_st) + "\n");
+
+  auto cast = [&](auto t) {
+    using T = decltype(t);
+    FieldLinComb<T> et;
+    for (int i=0; i<e.num_terms; ++i) {
+      et.add_term(e.fields[i],static_cast<T>(e.coeffs[i]));
+    }
+    evaluate_impl<HD,T>(y,et,static_cast<T>(beta),use_y);
+  };
+
+  if (dt==DataType::IntType) {
+    cast(int(0));
+  } else if (dt==DataType::FloatType) {
+    cast(float(0));
+  } else if (dt==DataType::DoubleType) {
+    cast(double(0));
+  } else {
+    EKAT_ERROR_MSG ("Error! Unrecognized/unsupported field data type in expression evaluation.\n");
+  }
+}
+
+} // namespace impl
+
+// y = e
+template<HostOrDevice HD = Device, typename ST>
+void evaluate (const Field& y, const FieldLinComb<ST>& e)
+{
+  impl::evaluate<HD>(y,e,ST(0),false);
+}
+
+// y = beta*y + e
+template<HostOrDevice HD = Device, typename ST>
+void evaluate (const Field& y, const FieldLinComb<ST>& e, const ST beta)
+{
+  impl::evaluate<HD>(y,e,beta,true);
+}
+
+// Rescale all the fields of a group, y = beta*y, skipping fill values.
+// If the group is bundled, the bundle is rescaled. Otherwise, all fields that
+// own their (contiguous) allocation are rescaled with a single kernel, while
+// the others (e.g., subfields of other fields) fall back to Field::scale.
+template<HostOrDevice HD = Device, typename ST>
+void scale (const FieldGroup& group, const ST beta)
+{
+  if (group.m_bundle) {
+    group.m_bundle->scale<HD>(beta);
+    return;
+  }
+
+  using device_t   = typename Field::get_device<HD>;
+  using exec_space = typename device_t::execution_space;
+  using KT         = ekat::KokkosTypes<device_t>;
+
+  using Slab       = impl::FieldSlab<ST>;
+
+  std::vector<Slab> slabs;
+  int size = 0;
+  for (const auto& it : group.m_fields) {
+    auto&       f  = *it.second;
+    const auto& fh = f.get_header();
+    const auto& fl = fh.get_identifier().get_layout();
+
+    if (not fh.get_parent().expired() || not fh.get_alloc_properties().contiguous() ||
+        f.data_type()!=get_data_type<ST>()) {
+      f.scale<HD>(beta);
+      continue;
+    }
+
+    ST fill_val = constants::DefaultFillValue<ST>().value;
+    if (fh.has_extra_data("mask_value")) {
+      fill_val = fh.get_extra_data<ST>("mask_value");
+    }
+
+    Slab s;
+    s.data     = f.get_internal_view_data<ST,HD>();
+    s.ncols    = fl.rank()>0 ? fl.dims().back() : 1;
+    s.stride   = fl.rank()>0 ? fh.get_alloc_properties().get_last_extent() : 1;
+    s.offset   = size;
+    s.fill_val = fill_val;
+    slabs.push_back(s);
+    size += fl.size();
+  }
+
+  const int num_slabs = slabs.size();
+  if (num_slabs==0) {
+    return;
+  }
+
+  typename KT::template view_1d<Slab> slabs_d ("",num_slabs);
+  auto slabs_h = Kokkos::create_mirror_view(slabs_d);
+  for (int i=0; i<num_slabs; ++i) {
+    slabs_h(i) = slabs[i];
+  }
+  Kokkos::deep_copy(slabs_d,slabs_h);
+
+  using RangePolicy = Kokkos::RangePolicy<exec_space>;
+  Kokkos::parallel_for(RangePolicy(0,size), KOKKOS_LAMBDA(const int idx) {
+    // Find the slab containing idx (the number of fields in a group is small)
+    int islab = num_slabs-1;
+    while (slabs_d(islab).offset>idx) {
+      --islab;
+    }
+    const auto& s = slabs_d(islab);
+    const int i = idx - s.offset;
+    auto& y = s.data[(i / s.ncols)*s.stride + i % s.ncols];
+    combine_and_fill<CombineMode::Rescale>(y,y,s.fill_val,ST(0),beta);
+  });
+  Kokkos::fence();
+}
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_LINCOMB_HPP
@@ -1,15 +1,143 @@
 #include "share/grid/abstract_grid.hpp"
 
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_utils.hpp"
 
 #include <ekat/ekat_assert.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <string>
 
 namespace scream
 {
+
+namespace {
+
+using gid_type   = AbstractGrid::gid_type;
+using gid_view_h = AbstractGrid::gid_view_h;
+
+// A distributed (rendezvous) directory of the gids owned by each rank of a grid.
+// Each gid is hashed to a "home" rank, which stores the pid/lid of its owner.
+// Building the directory takes one all-to-all exchange, and looking up a set of
+// gids takes two (queries to the home ranks, and their replies), as opposed to
+// letting each rank broadcast its gids to all other ranks, which is O(P*N).
+class GidsDirectory {
+public:
+  GidsDirectory (const gid_type* gids, const int num_gids, const ekat::Comm& comm)
+   : m_comm (comm)
+  {
+    // Send (gid,lid) pairs to the gid home rank. Since recvs are ordered by
+    // sender pid, the first owner registered for a gid is the lowest pid.
+    std::vector<std::vector<gid_type>> sends(m_comm.size());
+    for (int lid=0; lid<num_gids; ++lid) {
+      auto& s = sends[home(gids[lid])];
+      s.push_back(gids[lid]);
+      s.push_back(lid);
+    }
+    auto recvs = all_to_all(sends,m_comm);
+    for (int pid=0; pid<m_comm.size(); ++pid) {
+      const auto& r = recvs[pid];
+      for (size_t i=0; i<r.size(); i+=2) {
+        auto it = m_owners.find(r[i]);
+        if (it==m_owners.end()) {
+          m_owners.emplace(r[i],Owner{pid,static_cast<int>(r[i+1]),-1});
+        } else if (it->second.other_pid==-1) {
+          it->second.other_pid = pid;
+        }
+      }
+    }
+  }
+
+  // Whether all gids are owned by exactly one rank (collective)
+  bool is_unique () const {
+    int my_unique = 1;
+    for (const auto& it : m_owners) {
+      if (it.second.other_pid!=-1) {
+        my_unique = 0;
+        break;
+      }
+    }
+    int unique;
+    m_comm.all_reduce(&my_unique,&unique,1,MPI_PROD);
+    return unique==1;
+  }
+
+  // For each input gid, retrieve owner pid and lid, or -1 if no rank owns it (collective).
+  // Errors out if any of the input gids has multiple owners.
+  void lookup (const gid_view_h& gids, std::vector<int>& pids, std::vector<int>& lids) const
+  {
+    const int num_gids = gids.size();
+    pids.assign(num_gids,-1);
+    lids.assign(num_gids,-1);
+
+    // Query each distinct gid only once, and remember where to put the answer
+    std::map<gid_type,std::vector<int>> gid2idx;
+    for (int i=0; i<num_gids; ++i) {
+      gid2idx[gids[i]].push_back(i);
+    }
+    std::vector<std::vector<gid_type>> queries(m_comm.size());
+    for (const auto& it : gid2idx) {
+      queries[home(it.first)].push_back(it.first);
+    }
+
+    // Home ranks answer with (pid,lid,other_pid) triplets, in the order of the queries
+    auto recvd = all_to_all(queries,m_comm);
+    std::vector<std::vector<int>> replies(m_comm.size());
+    for (int pid=0; pid<m_comm.size(); ++pid) {
+      for (auto gid : recvd[pid]) {
+        auto it = m_owners.find(gid);
+        if (it==m_owners.end()) {
+          replies[pid].insert(replies[pid].end(),{-1,-1,-1});
+        } else {
+          const auto& o = it->second;
+          replies[pid].insert(replies[pid].end(),{o.pid,o.lid,o.other_pid});
+        }
+      }
+    }
+    auto answers = all_to_all(replies,m_comm);
+
+    for (int pid=0; pid<m_comm.size(); ++pid) {
+      const auto& q = queries[pid];
+      const auto& a = answers[pid];
+      for (size_t i=0; i<q.size(); ++i) {
+        EKAT_REQUIRE_MSG (a[3*i+2]==-1,
+            "Error! Found a GID with multiple owners.\n"
+            "  - gid: " + std::to_string(q[i]) + "\n"
+            "  - owner 1: " + std::to_string(a[3*i]) + "\n"
+            "  - owner 2: " + std::to_string(a[3*i+2]) + "\n");
+        for (auto idx : gid2idx.at(q[i])) {
+          pids[idx] = a[3*i];
+          lids[idx] = a[3*i+1];
+        }
+      }
+    }
+  }
+
+private:
+
+  // Mix the gid bits (splitmix64 finalizer) before taking the modulo, so that gids
+  // following a pattern with stride multiple of the comm size still spread evenly
+  int home (const gid_type gid) const {
+    std::uint64_t x = static_cast<std::uint64_t>(gid);
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    x = x ^ (x >> 31);
+    return static_cast<int>(x % static_cast<std::uint64_t>(m_comm.size()));
+  }
+
+  struct Owner {
+    int pid;
+    int lid;
+    int other_pid; // Another rank owning the same gid (-1 if none)
+  };
+
+  ekat::Comm                m_comm;
+  std::map<gid_type,Owner>  m_owners;
+};
+
+} // anonymous namespace
 // Constructor(s) & Destructor
 AbstractGrid::
 AbstractGrid (const std::string& name,
@@ -134,45 +262,9 @@ bool AbstractGrid::is_unique () const {
     }
 
     // Each rank has unique gids locally. Now it's time to verify if they are also globally unique.
-    int max_dofs;
-    m_comm.all_reduce(&m_num_local_dofs,&max_dofs,1,MPI_MAX);
-    std::vector<gid_type> gids(max_dofs,-1);
-    int unique_gids = 1;
-
-    for (int pid=0; pid<m_comm.size(); ++pid) {
-      // Rank pid broadcasts its gids, everyone else checks if there are duplicates
-      if (pid==m_comm.rank()) {
-        auto start = dofs_h.data();
-        auto end   = start + m_num_local_dofs;
-        std::copy(start,end,gids.data());
-      }
-
-      int ndofs = m_num_local_dofs;
-      m_comm.broadcast(&ndofs,1,pid);
-      m_comm.broadcast(gids.data(),ndofs,pid);
-
-      int my_unique_gids = 1;
-      if (pid!=m_comm.rank()) {
-        // Checking two sorted arrays of length m and n for elements in common is O(m+n) ops.
-        int i=0, j=0;
-        while (i<m_num_local_dofs && j<ndofs && my_unique_gids==1) {
-          if (dofs_h[i]<gids[j]) {
-            ++i;
-          } else if (dofs_h[i]>gids[j]) {
-            ++j;
-          } else {
-            // Found a match. We can stop here
-            my_unique_gids = 0;
-            break;
-          }
-        }
-      }
-      m_comm.all_reduce(&my_unique_gids,&unique_gids,1,MPI_PROD);
-      if (unique_gids==0) {
-        break;
-      }
-    }
-    return unique_gids==1;
+    // The home rank of each gid in the gids directory can spot duplicates.
+    GidsDirectory directory(dofs_h.data(),m_num_local_dofs,m_comm);
+    return directory.is_unique();
   };
 
   if (not m_is_unique_computed) {
@@ -402,66 +494,9 @@ AbstractGrid::get_unique_gids () const
 std::vector<int> AbstractGrid::
 get_owners (const gid_view_h& gids) const
 {
-  const auto& comm = get_comm();
-
-  // Init owners to in
-  std::map<gid_type,int> owners;
-  int num_gids_in = gids.size();
-  for (int i=0; i<num_gids_in; ++i) {
-    owners[gids[i]] = -1;
-  }
-  int num_found = 0;
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid && num_found<num_gids_in; ++i) {
-      auto it = owners.find(data[i]);
-      if (it!=owners.end()) {
-        EKAT_REQUIRE_MSG (it->second==-1,
-            "Error! Found a GID with multiple owners.\n"
-            "  - owner 1: " + std::to_string(it->second) + "\n"
-            "  - owner 2: " + std::to_string(pid) + "\n");
-        it->second = pid;
-        ++num_found;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_found==static_cast<int>(owners.size()),
-      "Error! Could not locate the owner of one of the input GIDs.\n"
-      "  - rank: " + std::to_string(comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_found) + "\n"
-      "  - num gids in: " + std::to_string(num_gids_in) + "\n");
-
-
-  // Now create and fill output view
-  std::vector<int> result(num_gids_in);
-  for (int i=0; i<num_gids_in; ++i) {
-    result[i] = owners.at(gids[i]);
-  }
-
-  return result;
+  std::vector<int> pids, lids;
+  get_remote_pids_and_lids(gids,pids,lids);
+  return pids;
 }
 
 void AbstractGrid::
@@ -470,65 +505,18 @@ get_remote_pids_and_lids (const gid_view_h& gids,
                           std::vector<int>& lids) const
 {
   const auto& comm = get_comm();
-  int num_gids_in = gids.size();
-
-  pids.resize(num_gids_in,-1);
-  lids.resize(num_gids_in,-1);
+  const int num_gids_in = gids.size();
 
-  int num_found = 0;
+  auto my_gids_h = m_dofs_gids.get_view<const gid_type*,Host>();
+  GidsDirectory directory(my_gids_h.data(),m_num_local_dofs,comm);
+  directory.lookup(gids,pids,lids);
 
-  // We may have repeated gids. In that case, we want to update
-  // the pids/lids arrays at all indices corresponding to the same gid
-  std::map<gid_type,std::vector<int>> gid2idx;
-  for (int i=0; i<num_gids_in; ++i) {
-    gid2idx[gids[i]].push_back(i);
-  }
-  int num_unique_gids = gid2idx.size();
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2idx.find(data[i]);
-      if (it!=gid2idx.end()) {
-        for (auto idx : it->second) {
-          EKAT_REQUIRE_MSG (pids[idx]==-1,
-              "Error! Found a GID with multiple owners.\n"
-              "  - owner 1: " + std::to_string(pids[idx]) + "\n"
-              "  - owner 2: " + std::to_string(pid) + "\n");
-          pids[idx] = pid;
-          lids[idx] = i;
-        }
-        ++num_found;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_found==num_unique_gids,
+  const int num_found = std::count_if(pids.begin(),pids.end(),[](const int pid) { return pid>=0; });
+  EKAT_REQUIRE_MSG (num_found==num_gids_in,
       "Error! Could not locate the owner of one of the input GIDs.\n"
       "  - rank: " + std::to_string(comm.rank()) + "\n"
       "  - num found: " + std::to_string(num_found) + "\n"
-      "  - num unique gids in: " + std::to_string(num_unique_gids) + "\n");
+      "  - num gids in: " + std::to_string(num_gids_in) + "\n");
 }
 
 void AbstractGrid::create_dof_fields (const int scalar2d_layout_rank)
@@ -0,0 +1,300 @@
+#include "share/grid/remap/column_subset_remapper.hpp"
+
+#include "share/grid/point_grid.hpp"
+#include "physics/share/physics_constants.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <limits>
+
+namespace scream
+{
+
+ColumnSubsetRemapper::
+ColumnSubsetRemapper (const grid_ptr_type& src_grid,
+                      const std::vector<Real>& tgt_lats,
+                      const std::vector<Real>& tgt_lons)
+{
+  // Sanity checks
+  EKAT_REQUIRE_MSG (src_grid->type()==GridType::Point,
+      "Error! ColumnSubsetRemapper only works on PointGrid grids.\n"
+      "  - src grid name: " + src_grid->name() + "\n"
+      "  - src_grid_type: " + e2str(src_grid->type()) + "\n");
+  EKAT_REQUIRE_MSG (src_grid->is_unique(),
+      "Error! ColumnSubsetRemapper requires a unique source grid.\n");
+  EKAT_REQUIRE_MSG (src_grid->has_geometry_data("lat") and src_grid->has_geometry_data("lon"),
+      "Error! ColumnSubsetRemapper requires lat/lon geometry data on the source grid.\n"
+      "  - src grid name: " + src_grid->name() + "\n");
+  EKAT_REQUIRE_MSG (tgt_lats.size()==tgt_lons.size(),
+      "Error! Target latitudes and longitudes lists have different lengths.\n"
+      "  - num lats: " + std::to_string(tgt_lats.size()) + "\n"
+      "  - num lons: " + std::to_string(tgt_lons.size()) + "\n");
+  EKAT_REQUIRE_MSG (tgt_lats.size()>0,
+      "Error! ColumnSubsetRemapper requires at least one target location.\n");
+  for (size_t i=0; i<tgt_lats.size(); ++i) {
+    EKAT_REQUIRE_MSG (-90<=tgt_lats[i] and tgt_lats[i]<=90,
+        "Error! Target latitude outside of expected range [-90, 90].\n"
+        "  - location index: " + std::to_string(i) + "\n"
+        "  - latitude: " + std::to_string(tgt_lats[i]) + "\n");
+  }
+
+  // This is a special remapper. We only go in one direction
+  m_bwd_allowed = false;
+
+  m_src_grid = src_grid;
+  find_closest_columns (tgt_lats,tgt_lons);
+
+  // Build the tgt grid. The gid of each column is the index of the corresponding target location
+  const auto& comm = src_grid->get_comm();
+  const int num_tgt_cols = m_src_lids.extent(0);
+  const int nlevs = src_grid->get_num_vertical_levels();
+  auto tgt_grid = std::make_shared<PointGrid>(src_grid->name()+" Column Subset",
+                                              num_tgt_cols,nlevs,comm);
+  auto tgt_gids_h = tgt_grid->get_dofs_gids().get_view<AbstractGrid::gid_type*,Host>();
+  for (int i=0; i<num_tgt_cols; ++i) {
+    tgt_gids_h(i) = m_tgt_gids[i];
+  }
+  tgt_grid->get_dofs_gids().sync_to_dev();
+
+  // Copy all geometry data that only depends on the column (lat, lon, area,...)
+  using namespace ShortFieldTagsNames;
+  for (const auto& name : src_grid->get_geometry_data_names()) {
+    const auto& src = src_grid->get_geometry_data(name);
+    const auto& fid = src.get_header().get_identifier();
+    const auto& fl  = fid.get_layout();
+    if (fl.rank()!=1 or not fl.has_tag(COL) or src.data_type()!=DataType::RealType) {
+      continue;
+    }
+    auto tgt = tgt_grid->create_geometry_data(name,tgt_grid->get_2d_scalar_layout(),fid.get_units());
+    gather_columns (src,tgt);
+  }
+
+  set_grids(m_src_grid,tgt_grid);
+}
+
+FieldLayout ColumnSubsetRemapper::
+create_src_layout (const FieldLayout& tgt_layout) const
+{
+  EKAT_REQUIRE_MSG (is_valid_tgt_layout(tgt_layout),
+      "[ColumnSubsetRemapper] Error! Input target layout is not valid for this remapper.\n"
+      " - input layout: " + tgt_layout.to_string());
+
+  using namespace ShortFieldTagsNames;
+  return tgt_layout.clone().reset_dim(COL,m_src_grid->get_num_local_dofs());
+}
+
+FieldLayout ColumnSubsetRemapper::
+create_tgt_layout (const FieldLayout& src_layout) const
+{
+  EKAT_REQUIRE_MSG (is_valid_src_layout(src_layout),
+      "[ColumnSubsetRemapper] Error! Input source layout is not valid for this remapper.\n"
+      " - input layout: " + src_layout.to_string());
+
+  using namespace ShortFieldTagsNames;
+  return src_layout.clone().reset_dim(COL,m_src_lids.extent(0));
+}
+
+void ColumnSubsetRemapper::
+do_register_field (const identifier_type& src, const identifier_type& tgt)
+{
+  constexpr auto COL = ShortFieldTagsNames::COL;
+  EKAT_REQUIRE_MSG (src.get_layout().has_tag(COL) and src.get_layout().tag(0)==COL,
+      "Error! ColumnSubsetRemapper requires fields with COL as first dimension.\n"
+      "  - field name: " + src.name() + "\n"
+      "  - field layout: " + src.get_layout().to_string() + "\n");
+  m_src_fields.push_back(field_type(src));
+  m_tgt_fields.push_back(field_type(tgt));
+}
+
+void ColumnSubsetRemapper::
+do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
+{
+  EKAT_REQUIRE_MSG (src.data_type()==DataType::RealType,
+      "Error! ColumnSubsetRemapper only allows fields with RealType data.\n"
+      "  - src field name: " + src.name() + "\n"
+      "  - src field type: " + e2str(src.data_type()) + "\n");
+  EKAT_REQUIRE_MSG (tgt.data_type()==DataType::RealType,
+      "Error! ColumnSubsetRemapper only allows fields with RealType data.\n"
+      "  - tgt field name: " + tgt.name() + "\n"
+      "  - tgt field type: " + e2str(tgt.data_type()) + "\n");
+
+  m_src_fields[ifield] = src;
+  m_tgt_fields[ifield] = tgt;
+}
+
+void ColumnSubsetRemapper::do_remap_fwd ()
+{
+  for (int i=0; i<m_num_fields; ++i) {
+    gather_columns (m_src_fields[i],m_tgt_fields[i]);
+  }
+}
+
+void ColumnSubsetRemapper::
+find_closest_columns (const std::vector<Real>& tgt_lats,
+                      const std::vector<Real>& tgt_lons)
+{
+  using TeamPolicy = typename KT::TeamPolicy;
+  using MemberType = typename KT::MemberType;
+  using minloc_t       = Kokkos::MinLoc<double,int>;
+  using minloc_value_t = typename minloc_t::value_type;
+  using PC = scream::physics::Constants<double>;
+
+  const int nlocs = tgt_lats.size();
+  const int ncols = m_src_grid->get_num_local_dofs();
+
+  view_1d<double> locs_lat ("",nlocs);
+  view_1d<double> locs_lon ("",nlocs);
+  auto locs_lat_h = Kokkos::create_mirror_view(locs_lat);
+  auto locs_lon_h = Kokkos::create_mirror_view(locs_lon);
+  for (int i=0; i<nlocs; ++i) {
+    locs_lat_h(i) = tgt_lats[i];
+    locs_lon_h(i) = tgt_lons[i];
+  }
+  Kokkos::deep_copy(locs_lat,locs_lat_h);
+  Kokkos::deep_copy(locs_lon,locs_lon_h);
+
+  // For each location, find the closest local column. We compare the haversine
+  // of the great-circle angle, which is monotone with the distance, and, unlike
+  // the cosine of the angle, does not lose precision for nearby points.
+  const auto lat = m_src_grid->get_geometry_data("lat").get_view<const Real*>();
+  const auto lon = m_src_grid->get_geometry_data("lon").get_view<const Real*>();
+  view_1d<double> dist ("",nlocs);
+  view_1d<int>    lids ("",nlocs);
+  const double deg2rad = PC::Pi/180;
+  const auto policy = TeamPolicy(nlocs,Kokkos::AUTO);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const int iloc = team.league_rank();
+    const double lat0 = locs_lat(iloc)*deg2rad;
+    const double lon0 = locs_lon(iloc)*deg2rad;
+    const double cos_lat0 = Kokkos::cos(lat0);
+    minloc_value_t result;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,ncols),
+                            [&](const int icol, minloc_value_t& r) {
+      const double lat1 = lat(icol)*deg2rad;
+      const double lon1 = lon(icol)*deg2rad;
+      const double sdlat = Kokkos::sin((lat1-lat0)/2);
+      const double sdlon = Kokkos::sin((lon1-lon0)/2);
+      const double hav = sdlat*sdlat + cos_lat0*Kokkos::cos(lat1)*sdlon*sdlon;
+      if (hav<r.val) {
+        r.val = hav;
+        r.loc = icol;
+      }
+    }, minloc_t(result));
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      dist(iloc) = ncols>0 ? result.val : std::numeric_limits<double>::max();
+      lids(iloc) = ncols>0 ? result.loc : -1;
+    });
+  });
+  auto dist_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),dist);
+  auto lids_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),lids);
+
+  // Each location goes to the rank owning the closest column. In case of ties,
+  // pick the lowest rank, so that each location is owned by exactly one rank.
+  const auto& comm = m_src_grid->get_comm();
+  std::vector<double> min_dist(nlocs);
+  comm.all_reduce(dist_h.data(),min_dist.data(),nlocs,MPI_MIN);
+
+  std::vector<int> my_rank(nlocs), owner(nlocs);
+  for (int i=0; i<nlocs; ++i) {
+    my_rank[i] = (lids_h(i)>=0 and dist_h(i)==min_dist[i]) ? comm.rank() : comm.size();
+  }
+  comm.all_reduce(my_rank.data(),owner.data(),nlocs,MPI_MIN);
+
+  std::vector<int> my_lids;
+  m_tgt_gids.clear();
+  for (int i=0; i<nlocs; ++i) {
+    EKAT_REQUIRE_MSG (owner[i]<comm.size(),
+        "Error! Could not find a column close to the target location.\n"
+        "  - location index: " + std::to_string(i) + "\n"
+        "  - src grid name: " + m_src_grid->name() + "\n");
+    if (owner[i]==comm.rank()) {
+      my_lids.push_back(lids_h(i));
+      m_tgt_gids.push_back(i);
+    }
+  }
+
+  m_src_lids = view_1d<int>("",my_lids.size());
+  auto src_lids_h = Kokkos::create_mirror_view(m_src_lids);
+  for (size_t i=0; i<my_lids.size(); ++i) {
+    src_lids_h(i) = my_lids[i];
+  }
+  Kokkos::deep_copy(m_src_lids,src_lids_h);
+}
+
+void ColumnSubsetRemapper::
+gather_columns (const Field& x, const Field& y) const
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto& tgt_layout = y.get_header().get_identifier().get_layout();
+  const int   rank       = tgt_layout.rank();
+  const int   ncols      = m_src_lids.extent(0);
+
+  auto lids = m_src_lids;
+  switch (rank) {
+    case 1:
+    {
+      // Unlike get_view, get_strided_view returns a LayoutStride view,
+      // therefore allowing the 1d field to be a subfield of a 2d field
+      // along the 2nd dimension.
+      auto x_view = x.get_strided_view<const Real*>();
+      auto y_view = y.get_strided_view<      Real*>();
+      Kokkos::parallel_for(RangePolicy(0,ncols),
+                           KOKKOS_LAMBDA(const int& icol) {
+        y_view(icol) = x_view(lids(icol));
+      });
+      break;
+    }
+    case 2:
+    {
+      auto x_view = x.get_view<const Real**>();
+      auto y_view = y.get_view<      Real**>();
+      const int dim1 = tgt_layout.dim(1);
+      Kokkos::parallel_for(RangePolicy(0,ncols*dim1),
+                           KOKKOS_LAMBDA(const int& idx) {
+        const int icol = idx / dim1;
+        const int j    = idx % dim1;
+        y_view(icol,j) = x_view(lids(icol),j);
+      });
+      break;
+    }
+    case 3:
+    {
+      auto x_view = x.get_view<const Real***>();
+      auto y_view = y.get_view<      Real***>();
+      const int dim1 = tgt_layout.dim(1);
+      const int dim2 = tgt_layout.dim(2);
+      Kokkos::parallel_for(RangePolicy(0,ncols*dim1*dim2),
+                           KOKKOS_LAMBDA(const int& idx) {
+        const int icol = idx / (dim1*dim2);
+        const int j    = (idx / dim2) % dim1;
+        const int k    = idx % dim2;
+        y_view(icol,j,k) = x_view(lids(icol),j,k);
+      });
+      break;
+    }
+    case 4:
+    {
+      auto x_view = x.get_view<const Real****>();
+      auto y_view = y.get_view<      Real****>();
+      const int dim1 = tgt_layout.dim(1);
+      const int dim2 = tgt_layout.dim(2);
+      const int dim3 = tgt_layout.dim(3);
+      Kokkos::parallel_for(RangePolicy(0,ncols*dim1*dim2*dim3),
+                           KOKKOS_LAMBDA(const int& idx) {
+        const int icol = idx / (dim1*dim2*dim3);
+        const int j    = (idx / (dim2*dim3)) % dim1;
+        const int k    = (idx / dim3) % dim2;
+        const int l    = idx % dim3;
+        y_view(icol,j,k,l) = x_view(lids(icol),j,k,l);
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG("Error::column_subset_remapper::gather_columns,\n"
+                     "  field " + x.name() + " has rank " + std::to_string(rank) +
+                     " which is not supported.\n");
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,108 @@
+#ifndef SCREAM_COLUMN_SUBSET_REMAPPER_HPP
+#define SCREAM_COLUMN_SUBSET_REMAPPER_HPP
+
+#include "share/grid/remap/abstract_remapper.hpp"
+#include "share/scream_types.hpp"
+
+namespace scream
+{
+
+/*
+ * A remapper that extracts a sparse set of columns from a PointGrid
+ *
+ * Given a list of target (lat,lon) locations (e.g., observation sites), the
+ * remapper finds the closest column of the source grid to each of them (using
+ * the great-circle distance). This is done once, at construction time, on device.
+ * The target grid is a PointGrid with one column per target location (with
+ * gid equal to the index of the location in the input list), owned by the rank
+ * that owns the corresponding source column. The target grid stores lat/lon
+ * (as well as any other column-only geometry data) of the selected columns.
+ *
+ * Remapping is a simple gather of the selected columns, which happens on device,
+ * and requires no MPI communication. Hence, outputting a handful of sites from
+ * a high-res grid only requires copying a handful of columns to host.
+ *
+ * Notes:
+ *  - the source grid must be a PointGrid, storing "lat" and "lon" geometry data (in degrees)
+ *  - if two locations have the same closest column, the column appears twice in the tgt grid
+ *  - only forward remap is supported
+ */
+
+class ColumnSubsetRemapper : public AbstractRemapper
+{
+public:
+  ColumnSubsetRemapper (const grid_ptr_type& src_grid,
+                        const std::vector<Real>& tgt_lats,
+                        const std::vector<Real>& tgt_lons);
+
+  ~ColumnSubsetRemapper () = default;
+
+  FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
+  FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override;
+
+  bool compatible_layouts (const layout_type& src,
+                           const layout_type& tgt) const override {
+    // Same type of layout, and same sizes except for possibly the first one
+    // Note: we can't do [src|tgt].size()/[src|tgt].dim(0)), since there may
+    // be 0 src/tgt gids on some ranks, which means src/tgt.dim(0)=0.
+    using namespace ShortFieldTagsNames;
+
+    // Use congruence, since we don't really care about dimension names, only tags/extents
+    return src.clone().strip_dim(COL).congruent(tgt.clone().strip_dim(COL));
+  }
+
+protected:
+
+  const identifier_type& do_get_src_field_id (const int ifield) const override {
+    return m_src_fields[ifield].get_header().get_identifier();
+  }
+  const identifier_type& do_get_tgt_field_id (const int ifield) const override {
+    return m_tgt_fields[ifield].get_header().get_identifier();
+  }
+  const field_type& do_get_src_field (const int ifield) const override {
+    return m_src_fields[ifield];
+  }
+  const field_type& do_get_tgt_field (const int ifield) const override {
+    return m_tgt_fields[ifield];
+  }
+
+  void do_registration_begins () override { /* Nothing to do here */ }
+  void do_register_field (const identifier_type& src, const identifier_type& tgt) override;
+  void do_bind_field (const int ifield, const field_type& src, const field_type& tgt) override;
+  void do_registration_ends () override { /* Nothing to do here */ }
+
+  void do_remap_fwd () override;
+  void do_remap_bwd () override {
+    EKAT_ERROR_MSG ("ColumnSubsetRemapper only supports fwd remapping.\n");
+  }
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  // Find the closest src column to each target location
+  void find_closest_columns (const std::vector<Real>& tgt_lats,
+                             const std::vector<Real>& tgt_lons);
+
+  // Gather the selected columns of x into y
+  void gather_columns (const Field& x, const Field& y) const;
+
+protected:
+
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  std::vector<field_type>   m_src_fields;
+  std::vector<field_type>   m_tgt_fields;
+
+  // Local index in the src grid of each local column of the tgt grid
+  view_1d<int>              m_src_lids;
+
+  // Index of the target location of each local column of the tgt grid
+  std::vector<int>          m_tgt_gids;
+};
+
+} // namespace scream
+
+#endif // SCREAM_COLUMN_SUBSET_REMAPPER_HPP
@@ -1,9 +1,10 @@
 #include "horiz_interp_remapper_data.hpp"
 
 #include "share/grid/point_grid.hpp"
-#include "share/grid/grid_import_export.hpp"
+#include "share/util/scream_utils.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace scream {
@@ -115,29 +116,21 @@ get_my_triplets (const std::string& map_file) const
     id -= col_offset;
   }
 
-  // Create a grid based on the row gids I read in (may be duplicated across ranks)
-  std::vector<gid_type> unique_gids;
+  // 2. Send each triplet to the rank owning its fine grid gid. Owners are retrieved
+  //    via the fine grid distributed gids directory, and the triplets are then
+  //    shipped with a single all-to-all. Each rank only handles its own chunk
+  //    of the map, so memory and work per rank do not grow with the global map size.
   const auto& gids = type==InterpType::Refine ? rows : cols;
-  for (auto gid : gids) {
-    if (not ekat::contains(unique_gids,gid)) {
-      unique_gids.push_back(gid);
-    }
-  }
-  auto io_grid = std::make_shared<PointGrid> ("helper",unique_gids.size(),0,comm);
-  auto io_grid_gids_h = io_grid->get_dofs_gids().get_view<gid_type*,Host>();
-  int k = 0;
-  for (auto gid : unique_gids) {
-    io_grid_gids_h(k++) = gid;
-  }
-  io_grid->get_dofs_gids().sync_to_dev();
+  std::vector<gid_type> unique_gids (gids.begin(),gids.end());
+  std::sort(unique_gids.begin(),unique_gids.end());
+  unique_gids.erase(std::unique(unique_gids.begin(),unique_gids.end()),unique_gids.end());
+  const auto owners = fine_grid->get_owners(unique_gids);
 
-  // Create Triplets to export, sorted by gid
-  std::map<int,std::vector<Triplet>> io_triplets;
-  auto io_grid_gid2lid = io_grid->get_gid2lid_map();
+  std::vector<std::vector<Triplet>> sends(comm.size());
   for (int i=0; i<nlweights; ++i) {
-    auto gid = gids[i];
-    auto io_lid = io_grid_gid2lid[gid];
-    io_triplets[io_lid].emplace_back(rows[i], cols[i], S[i]);
+    auto it = std::lower_bound(unique_gids.begin(),unique_gids.end(),gids[i]);
+    const int pid = owners[std::distance(unique_gids.begin(),it)];
+    sends[pid].emplace_back(rows[i], cols[i], S[i]);
   }
 
   // Create data type for a triplet
@@ -146,20 +139,20 @@ get_my_triplets (const std::string& map_file) const
   int lengths[3] = {1,1,1};
   MPI_Aint displacements[3] = {0, offsetof(Triplet,col), offsetof(Triplet,w)};
   MPI_Datatype types[3] = {mpi_gid_t,mpi_gid_t,mpi_real_t};
-  MPI_Datatype mpi_triplet_t;
-  MPI_Type_create_struct (3,lengths,displacements,types,&mpi_triplet_t);
+  MPI_Datatype mpi_struct_t, mpi_triplet_t;
+  MPI_Type_create_struct (3,lengths,displacements,types,&mpi_struct_t);
+  // Account for trailing padding, since we send arrays of triplets
+  MPI_Type_create_resized (mpi_struct_t,0,sizeof(Triplet),&mpi_triplet_t);
   MPI_Type_commit(&mpi_triplet_t);
 
-  // Create import-export
-  GridImportExport imp_exp (fine_grid,io_grid);
-  std::map<int,std::vector<Triplet>> my_triplets_map;
-  imp_exp.gather(mpi_triplet_t,io_triplets,my_triplets_map);
+  auto recvs = all_to_all(sends,comm,mpi_triplet_t);
   MPI_Type_free(&mpi_triplet_t);
+  MPI_Type_free(&mpi_struct_t);
 
   std::vector<Triplet> my_triplets;
-  for (auto& it : my_triplets_map) {
-    my_triplets.reserve(my_triplets.size()+it.second.size());
-    std::move(it.second.begin(),it.second.end(),std::back_inserter(my_triplets));
+  for (auto& r : recvs) {
+    my_triplets.reserve(my_triplets.size()+r.size());
+    std::move(r.begin(),r.end(),std::back_inserter(my_triplets));
   }
 
   return my_triplets;
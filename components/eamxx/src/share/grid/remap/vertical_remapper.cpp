@@ -358,6 +358,87 @@ void VerticalRemapper::create_lin_interp()
     m_lin_interp_int_scalar =
       std::make_shared<ekat::LinInterp<Real,1>>(ncols,nlevs_src,nlevs_tgt);
   }
+
+  // Gather the fields slices to interpolate with each lin interp object
+  if (num_packed_mid>0) {
+    m_slices_mid_packed = create_slices<SCREAM_PACK_SIZE>(true,true);
+  }
+  if (num_scalar_mid>0) {
+    m_slices_mid_scalar = create_slices<1>(false,true);
+  }
+  if (num_packed_int>0) {
+    m_slices_int_packed = create_slices<SCREAM_PACK_SIZE>(true,false);
+  }
+  if (num_scalar_int>0) {
+    m_slices_int_scalar = create_slices<1>(false,false);
+  }
+}
+
+template<int Packsize>
+auto VerticalRemapper::
+create_slices (const bool packed, const bool midpoints) const
+ -> slices_view_t<Packsize>
+{
+  using namespace ShortFieldTagsNames;
+  using PackT = ekat::Pack<Real,Packsize>;
+  using slice_t = InterpSlice<Packsize>;
+
+  std::vector<slice_t> slices;
+  auto add_field = [&](const Field& f_src, const Field& f_tgt, const Real mask_val) {
+    const auto& type = m_field2type.at(f_src.name());
+    if (type.packed!=packed or type.midpoints!=midpoints) {
+      return;
+    }
+    switch (f_src.rank()) {
+      case 2:
+      {
+        auto f_src_v = f_src.get_view<const PackT**>();
+        auto f_tgt_v = f_tgt.get_view<      PackT**>();
+        slices.push_back({f_src_v.data(),f_tgt_v.data(),
+                          static_cast<int>(f_src_v.stride(0)),
+                          static_cast<int>(f_tgt_v.stride(0)),
+                          mask_val});
+        break;
+      }
+      case 3:
+      {
+        auto f_src_v = f_src.get_view<const PackT***>();
+        auto f_tgt_v = f_tgt.get_view<      PackT***>();
+        const int ncomps = f_src.get_header().get_identifier().get_layout().get_vector_dim();
+        for (int icmp=0; icmp<ncomps; ++icmp) {
+          slices.push_back({f_src_v.data()+icmp*f_src_v.stride(1),
+                            f_tgt_v.data()+icmp*f_tgt_v.stride(1),
+                            static_cast<int>(f_src_v.stride(0)),
+                            static_cast<int>(f_tgt_v.stride(0)),
+                            mask_val});
+        }
+        break;
+      }
+      default:
+        EKAT_ERROR_MSG (
+            "[VerticalRemapper::create_slices] Error! Unsupported field rank.\n"
+            " - src field name: " + f_src.name() + "\n"
+            " - src field rank: " + std::to_string(f_src.rank()) + "\n");
+    }
+  };
+
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& tgt_layout = m_tgt_fields[i].get_header().get_identifier().get_layout();
+    if (tgt_layout.has_tag(LEV)) {
+      add_field(m_src_fields[i],m_tgt_fields[i],m_mask_val);
+    }
+  }
+  for (unsigned i=0; i<m_tgt_masks.size(); ++i) {
+    add_field(m_src_masks[i],m_tgt_masks[i],0);
+  }
+
+  slices_view_t<Packsize> slices_d ("",slices.size());
+  auto slices_h = Kokkos::create_mirror_view(slices_d);
+  for (size_t i=0; i<slices.size(); ++i) {
+    slices_h(i) = slices[i];
+  }
+  Kokkos::deep_copy(slices_d,slices_h);
+  return slices_d;
 }
 
 void VerticalRemapper::do_remap_fwd ()
@@ -378,28 +459,27 @@ void VerticalRemapper::do_remap_fwd ()
 
   using namespace ShortFieldTagsNames;
 
-  // 2. Interpolate the fields
+  // 2. Interpolate all fields (and their masks) sharing the same lin interp
+  //    object at once, so each column setup is reused across all fields
+  if (m_lin_interp_mid_packed) {
+    apply_vertical_interpolation(*m_lin_interp_mid_packed,m_slices_mid_packed,m_src_pmid);
+  }
+  if (m_lin_interp_int_packed) {
+    apply_vertical_interpolation(*m_lin_interp_int_packed,m_slices_int_packed,m_src_pint);
+  }
+  if (m_lin_interp_mid_scalar) {
+    apply_vertical_interpolation(*m_lin_interp_mid_scalar,m_slices_mid_scalar,m_src_pmid);
+  }
+  if (m_lin_interp_int_scalar) {
+    apply_vertical_interpolation(*m_lin_interp_int_scalar,m_slices_int_scalar,m_src_pint);
+  }
+
+  // 3. Copy the fields that do not need vertical interpolation
   for (int i=0; i<m_num_fields; ++i) {
     const auto& f_src    = m_src_fields[i];
           auto& f_tgt    = m_tgt_fields[i];
     const auto& tgt_layout   = f_tgt.get_header().get_identifier().get_layout();
-    if (tgt_layout.has_tag(LEV)) {
-      const auto& type = m_field2type.at(f_src.name());
-      // Dispatch interpolation to the proper lin interp object
-      if (type.midpoints) {
-        if (type.packed) {
-          apply_vertical_interpolation(*m_lin_interp_mid_packed,f_src,f_tgt,m_src_pmid,m_mask_val);
-        } else {
-          apply_vertical_interpolation(*m_lin_interp_mid_scalar,f_src,f_tgt,m_src_pmid,m_mask_val);
-        }
-      } else {
-        if (type.packed) {
-          apply_vertical_interpolation(*m_lin_interp_int_packed,f_src,f_tgt,m_src_pint,m_mask_val);
-        } else {
-          apply_vertical_interpolation(*m_lin_interp_int_scalar,f_src,f_tgt,m_src_pint,m_mask_val);
-        }
-      }
-    } else {
+    if (not tgt_layout.has_tag(LEV)) {
       // There is nothing to do, this field does not need vertical interpolation,
       // so just copy it over.  Note, if this field has its own mask data make
       // sure that is copied too.
@@ -411,28 +491,6 @@ void VerticalRemapper::do_remap_fwd ()
       }
     }
   }
-
-  // 3. Interpolate the mask fields
-  for (unsigned i=0; i<m_tgt_masks.size(); ++i) {
-          auto& f_src = m_src_masks[i];
-          auto& f_tgt = m_tgt_masks[i];
-    const auto& type = m_field2type.at(f_src.name());
-
-    // Dispatch interpolation to the proper lin interp object
-    if (type.midpoints) {
-      if (type.packed) {
-        apply_vertical_interpolation(*m_lin_interp_mid_packed,f_src,f_tgt,m_src_pmid,0);
-      } else {
-        apply_vertical_interpolation(*m_lin_interp_mid_scalar,f_src,f_tgt,m_src_pmid,0);
-      }
-    } else {
-      if (type.packed) {
-        apply_vertical_interpolation(*m_lin_interp_int_packed,f_src,f_tgt,m_src_pint,0);
-      } else {
-        apply_vertical_interpolation(*m_lin_interp_int_scalar,f_src,f_tgt,m_src_pint,0);
-      }
-    }
-  }
 }
 
 template<int Packsize>
@@ -463,97 +521,60 @@ setup_lin_interp (const ekat::LinInterp<Real,Packsize>& lin_interp,
 template<int Packsize>
 void VerticalRemapper::
 apply_vertical_interpolation(const ekat::LinInterp<Real,Packsize>& lin_interp,
-                             const Field& f_src, const Field& f_tgt,
-                             const Field& p_src,
-                             const Real mask_val) const
+                             const slices_view_t<Packsize>& slices,
+                             const Field& p_src) const
 {
   // Note: if Packsize==1, we grab packs of size 1, which are for sure
   //       compatible with the allocation
   using LI_t = ekat::LinInterp<Real,Packsize>;
   using PackT = ekat::Pack<Real,Packsize>;
   using ESU = ekat::ExeSpaceUtils<DefaultDevice::execution_space>;
+  using src_view_t = ekat::Unmanaged<view_1d<const PackT>>;
+  using tgt_view_t = ekat::Unmanaged<view_1d<PackT>>;
+
+  const int nslices = slices.size();
+  if (nslices==0) {
+    return;
+  }
 
   auto p_src_v = p_src.get_view<const PackT**>();
   auto x_tgt = m_tgt_pressure.get_view<const PackT*>();
-  const auto& f_src_l = f_src.get_header().get_identifier().get_layout();
   const int ncols = m_src_grid->get_num_local_dofs();
   const int nlevs_tgt = m_tgt_grid->get_num_vertical_levels();
-  const int nlevs_src = f_src_l.dims().back();
+  const int nlevs_src = p_src.get_header().get_identifier().get_layout().dims().back();
   const int npacks_tgt = ekat::PackInfo<Packsize>::num_packs(nlevs_tgt);
+  const int npacks_src = ekat::PackInfo<Packsize>::num_packs(nlevs_src);
 
   const int last_src_pack_idx = ekat::PackInfo<Packsize>::last_pack_idx(nlevs_src);
   const int last_src_pack_end = ekat::PackInfo<Packsize>::last_vec_end(nlevs_src);
-  
-  switch(f_src.rank()) {
-    case 2:
-    {
-      auto f_src_v = f_src.get_view<const PackT**>();
-      auto f_tgt_v = f_tgt.get_view<      PackT**>();
-      auto policy = ESU::get_default_team_policy(ncols,npacks_tgt);
-      auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team) {
-
-        // Interpolate
-        const int icol = team.league_rank();
-        auto x_src = ekat::subview(p_src_v,icol);
-        auto y_src = ekat::subview(f_src_v,icol);
-        auto y_tgt = ekat::subview(f_tgt_v,icol);
-        lin_interp.lin_interp(team,x_src,x_tgt,y_src,y_tgt,icol);
-        team.team_barrier();
-
-        // If x_tgt is extrapolated, set to mask_val
-        auto x_min = x_src[0][0];
-        auto x_max = x_src[last_src_pack_idx][last_src_pack_end-1];
-        auto set_mask = [&](const int ipack) {
-          auto in_range = ekat::range<PackT>(ipack*Packsize) < nlevs_tgt;
-          auto oob = (x_tgt[ipack]<x_min or x_tgt[ipack]>x_max) and in_range;
-          if (oob.any()) {
-            y_tgt[ipack].set(oob,mask_val);
-          }
-        };
-        Kokkos::parallel_for (Kokkos::TeamThreadRange(team,npacks_tgt), set_mask);
-      };
-      Kokkos::parallel_for("VerticalRemapper::apply_vertical_interpolation",policy,lambda);
-      break;
-    }
-    case 3:
-    {
-      auto f_src_v = f_src.get_view<const PackT***>();
-      auto f_tgt_v = f_tgt.get_view<      PackT***>();
-      const auto& layout = f_src.get_header().get_identifier().get_layout();
-      const int ncomps = layout.get_vector_dim();
-      auto policy = ESU::get_default_team_policy(ncols*ncomps,npacks_tgt);
-
-      auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team)
-      {
-        // Interpolate
-        const int icol = team.league_rank() / ncomps;
-        const int icmp = team.league_rank() % ncomps;
-        auto x_src = ekat::subview(p_src_v,icol);
-        auto y_src = ekat::subview(f_src_v,icol,icmp);
-        auto y_tgt = ekat::subview(f_tgt_v,icol,icmp);
-        lin_interp.lin_interp(team,x_src,x_tgt,y_src,y_tgt,icol);
-        team.team_barrier();
-
-        // If x_tgt is extrapolated, set to mask_val
-        auto x_min = x_src[0][0];
-        auto x_max = x_src[last_src_pack_idx][last_src_pack_end-1];
-        auto set_mask = [&](const int ipack) {
-          auto oob = x_tgt[ipack]<x_min or x_tgt[ipack]>x_max;
-          if (oob.any()) {
-            y_tgt[ipack].set(oob,mask_val);
-          }
-        };
-        Kokkos::parallel_for (Kokkos::TeamThreadRange(team,npacks_tgt), set_mask);
-      };
-      Kokkos::parallel_for("VerticalRemapper::apply_vertical_interpolation",policy,lambda);
-      break;
-    }
-    default:
-      EKAT_ERROR_MSG (
-          "[VerticalRemapper::apply_vertical_interpolation] Error! Unsupported field rank.\n"
-          " - src field name: " + f_src.name() + "\n"
-          " - src field rank: " + std::to_string(f_src.rank()) + "\n");
-  }
+
+  // Consecutive teams work on the same column, for different slices
+  auto policy = ESU::get_default_team_policy(ncols*nslices,npacks_tgt);
+  auto lambda = KOKKOS_LAMBDA(typename LI_t::MemberType const& team) {
+    const int icol   = team.league_rank() / nslices;
+    const int islice = team.league_rank() % nslices;
+    const auto& s = slices(islice);
+
+    // Interpolate
+    auto x_src = ekat::subview(p_src_v,icol);
+    src_view_t y_src (s.src + icol*s.src_col_stride, npacks_src);
+    tgt_view_t y_tgt (s.tgt + icol*s.tgt_col_stride, npacks_tgt);
+    lin_interp.lin_interp(team,x_src,x_tgt,y_src,y_tgt,icol);
+    team.team_barrier();
+
+    // If x_tgt is extrapolated, set to mask_val
+    auto x_min = x_src[0][0];
+    auto x_max = x_src[last_src_pack_idx][last_src_pack_end-1];
+    auto set_mask = [&](const int ipack) {
+      auto in_range = ekat::range<PackT>(ipack*Packsize) < nlevs_tgt;
+      auto oob = (x_tgt[ipack]<x_min or x_tgt[ipack]>x_max) and in_range;
+      if (oob.any()) {
+        y_tgt[ipack].set(oob,s.mask_val);
+      }
+    };
+    Kokkos::parallel_for (Kokkos::TeamThreadRange(team,npacks_tgt), set_mask);
+  };
+  Kokkos::parallel_for("VerticalRemapper::apply_vertical_interpolation",policy,lambda);
 }
 
 } // namespace scream
@@ -92,14 +92,35 @@ protected:
   void set_pressure_levels (const std::string& map_file);
   void do_print();
 
+  // A column slice of a (field,component) pair to be interpolated.
+  // Entry (icol,ipack) of the slice is src[icol*src_col_stride+ipack]
+  // (same for tgt). Masks are stored as slices too, with mask_val=0.
+  template<int N>
+  struct InterpSlice {
+    using PackT = ekat::Pack<Real,N>;
+    const PackT* src;
+    PackT*       tgt;
+    int          src_col_stride;
+    int          tgt_col_stride;
+    Real         mask_val;
+  };
+
+  template<int N>
+  using slices_view_t = typename KokkosTypes<DefaultDevice>::template view_1d<InterpSlice<N>>;
+
+  // Gather the slices of all fields (and masks) that use a given lin interp object
+  template<int N>
+  slices_view_t<N> create_slices (const bool packed, const bool midpoints) const;
+
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // Interpolate all the slices in one kernel, reusing the
+  // bracketing indices computed by setup_lin_interp
   template<int N>
   void apply_vertical_interpolation (const ekat::LinInterp<Real,N>& lin_interp,
-                                     const Field& f_src, const Field& f_tgt,
-                                     const Field& p_src,
-                                     const Real mask_value) const;
+                                     const slices_view_t<N>& slices,
+                                     const Field& p_src) const;
 
 
   template<int N>
@@ -145,6 +166,12 @@ protected:
   std::shared_ptr<ekat::LinInterp<Real,SCREAM_PACK_SIZE>> m_lin_interp_int_packed;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_mid_scalar;
   std::shared_ptr<ekat::LinInterp<Real,1>>                m_lin_interp_int_scalar;
+
+  // Slices interpolated by each of the lin interp objects above
+  slices_view_t<SCREAM_PACK_SIZE> m_slices_mid_packed;
+  slices_view_t<SCREAM_PACK_SIZE> m_slices_int_packed;
+  slices_view_t<1>                m_slices_mid_scalar;
+  slices_view_t<1>                m_slices_int_scalar;
 };
 
 } // namespace scream
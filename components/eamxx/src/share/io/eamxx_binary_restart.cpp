@@ -0,0 +1,589 @@
+#include "share/io/eamxx_binary_restart.hpp"
+
+#include "share/io/scream_io_utils.hpp"
+#include "share/util/scream_timing.hpp"
+#include "share/util/scream_utils.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <sstream>
+
+namespace scream
+{
+
+namespace binary_restart {
+
+std::string rank_filename (const std::string& filename, const int rank)
+{
+  std::stringstream ss;
+  ss << filename << "." << std::setw(6) << std::setfill('0') << rank;
+  return ss.str();
+}
+
+bool is_binary_restart_file (const std::string& filename)
+{
+  const std::string ext = ".bin";
+  return filename.size()>ext.size() and
+         filename.compare(filename.size()-ext.size(),ext.size(),ext)==0;
+}
+
+namespace {
+
+// Helpers to serialize into a byte buffer
+template<typename T>
+void append (std::string& buf, const T& v) {
+  buf.append(reinterpret_cast<const char*>(&v),sizeof(T));
+}
+
+void append_str (std::string& buf, const std::string& s) {
+  append(buf,static_cast<std::int64_t>(s.size()));
+  buf += s;
+}
+
+// Helpers to deserialize from a stream
+template<typename T>
+T extract (std::istream& is, const std::string& filename) {
+  T v;
+  is.read(reinterpret_cast<char*>(&v),sizeof(T));
+  EKAT_REQUIRE_MSG (is.good(),
+      "Error! Unexpected end of binary restart file.\n"
+      " - file name: " + filename + "\n");
+  return v;
+}
+
+std::string extract_str (std::istream& is, const std::string& filename) {
+  const auto size = extract<std::int64_t>(is,filename);
+  std::string s(size,'\0');
+  if (size>0) {
+    is.read(&s[0],size);
+  }
+  EKAT_REQUIRE_MSG (is.good(),
+      "Error! Unexpected end of binary restart file.\n"
+      " - file name: " + filename + "\n");
+  return s;
+}
+
+void check_tag (std::istream& is, const std::string& tag, const std::string& filename) {
+  std::string s(tag.size(),'\0');
+  is.read(&s[0],tag.size());
+  EKAT_REQUIRE_MSG (is.good() and s==tag,
+      "Error! Invalid or truncated binary restart file.\n"
+      " - file name   : " + filename + "\n"
+      " - expected tag: " + tag + "\n");
+}
+
+} // anonymous namespace
+
+} // namespace binary_restart
+
+// ========================== BinaryRestartWriter ========================== //
+
+BinaryRestartWriter::
+BinaryRestartWriter (const ekat::Comm& comm,
+                     const ekat::ParameterList& params,
+                     const std::map<std::string,std::shared_ptr<fm_type>>& field_mgrs,
+                     const util::TimeStamp& run_t0)
+ : m_comm (comm)
+{
+  m_filename_prefix = params.get<std::string>("filename_prefix");
+
+  EKAT_REQUIRE_MSG(params.isSublist("output_control"),
+      "Error! The model restart parameter list is missing the sublist 'output_control'");
+  const auto& out_control_pl = params.sublist("output_control");
+  m_output_control.frequency_units = out_control_pl.get<std::string>("frequency_units");
+  if (not m_output_control.output_enabled()) {
+    return;
+  }
+  m_output_control.frequency = out_control_pl.get<int>("Frequency");
+  EKAT_REQUIRE_MSG (m_output_control.frequency>0,
+      "Error! Invalid frequency (" + std::to_string(m_output_control.frequency) + ") in model restart output_control. Please, use positive number.\n");
+  m_output_control.last_write_ts = run_t0;
+  m_output_control.compute_next_write_ts();
+
+  for (const auto& it : field_mgrs) {
+    const auto& fm = it.second;
+    if (not fm->has_group("RESTART")) {
+      // No field needs to be restarted on this grid.
+      continue;
+    }
+    const auto& grid = fm->get_grid();
+    const auto part_tag = grid->get_partitioned_dim_tag();
+
+    auto& sg = m_grids.emplace_back();
+    sg.name = grid->name();
+    sg.part_dim_name = grid->has_special_tag_name(part_tag)
+                     ? grid->get_special_tag_name(part_tag)
+                     : e2str(part_tag);
+
+    const int nlocal = grid->get_partitioned_dim_local_size();
+    auto gids_h = grid->get_partitioned_dim_gids().get_view<const AbstractGrid::gid_type*,Host>();
+    sg.gids.assign(gids_h.data(),gids_h.data()+nlocal);
+
+    const auto& restart_group = fm->get_groups_info().at("RESTART");
+    for (const auto& fn : restart_group->m_fields_names) {
+      auto& sf = sg.fields.emplace_back();
+      sf.src = fm->get_field(fn);
+      // A standalone (hence contiguous) copy of the field, which also serves
+      // as host buffer for the flush thread
+      sf.staging = sf.src.clone();
+
+      // Use the same dim names as the NetCDF model restart files
+      const auto& fl = sf.src.get_header().get_identifier().get_layout();
+      sf.part_dim = -1;
+      for (int i=0; i<fl.rank(); ++i) {
+        const auto t = fl.tag(i);
+        auto dim_name = grid->has_special_tag_name(t)
+                      ? grid->get_special_tag_name(t)
+                      : fl.names()[i];
+        if (dim_name=="dim") {
+          dim_name += std::to_string(fl.dim(i));
+        }
+        sf.dim_names.push_back(dim_name);
+        if (t==part_tag and sf.part_dim==-1) {
+          sf.part_dim = i;
+        }
+      }
+    }
+  }
+}
+
+BinaryRestartWriter::~BinaryRestartWriter ()
+{
+  // Don't let the flush thread outlive the staging buffers. Errors (if any)
+  // are ignored here, since we can't throw from a destructor.
+  if (m_pending_flush.valid()) {
+    m_pending_flush.wait();
+  }
+}
+
+void BinaryRestartWriter::
+add_global (const std::string& name, const ekat::any& global)
+{
+  EKAT_REQUIRE_MSG (m_globals.find(name)==m_globals.end(),
+      "Error! Global attribute was already set in this binary restart writer.\n"
+      " - global name: " + name + "\n");
+
+  m_globals[name] = global;
+}
+
+std::string BinaryRestartWriter::
+compute_filename (const util::TimeStamp& timestamp) const
+{
+  auto filename = m_filename_prefix + ".r";
+  filename += "." + e2str(OutputAvgType::Instant);
+  filename += "." + m_output_control.frequency_units + "_x" + std::to_string(m_output_control.frequency);
+  filename += "." + timestamp.to_string();
+  return filename + ".bin";
+}
+
+void BinaryRestartWriter::finish_pending_flush ()
+{
+  if (not m_pending_flush.valid()) {
+    return;
+  }
+
+  start_timer("EAMxx::IO::binary_restart::finish_pending_flush");
+
+  // get() rethrows any exception raised on the flush thread. Hold on to it,
+  // since all ranks must take part in the reduction below.
+  std::exception_ptr flush_error;
+  try {
+    m_pending_flush.get();
+  } catch (...) {
+    flush_error = std::current_exception();
+  }
+  int my_ok = flush_error ? 0 : 1;
+  int all_ok;
+  m_comm.all_reduce(&my_ok,&all_ok,1,MPI_MIN);
+
+  // Only point rpointer.atm to the new checkpoint once all ranks wrote it, so that
+  // a job dying during the flush still restarts from the previous checkpoint
+  if (all_ok==1 and m_comm.am_i_root()) {
+    update_rpointer();
+  }
+  stop_timer("EAMxx::IO::binary_restart::finish_pending_flush");
+
+  if (flush_error) {
+    std::rethrow_exception(flush_error);
+  }
+  EKAT_REQUIRE_MSG (all_ok==1,
+      "Error! Binary restart checkpoint could not be written on some ranks.\n"
+      " - file name: " + m_pending_filename + "\n");
+}
+
+void BinaryRestartWriter::update_rpointer ()
+{
+  // History restart streams may have appended to rpointer.atm since the
+  // checkpoint was staged. Keep those entries, but drop the old ones.
+  std::string content;
+  {
+    std::ifstream ifs("rpointer.atm");
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    content = ss.str();
+  }
+  if (content.compare(0,m_rpointer_snapshot.size(),m_rpointer_snapshot)==0) {
+    content.erase(0,m_rpointer_snapshot.size());
+  }
+
+  std::ofstream rpointer("rpointer.atm");  // Open rpointer and nuke its content
+  rpointer << m_pending_filename << std::endl;
+  rpointer << content;
+}
+
+void BinaryRestartWriter::run (const util::TimeStamp& timestamp)
+{
+  using namespace binary_restart;
+
+  if (not m_output_control.is_write_step(timestamp)) {
+    return;
+  }
+
+  start_timer("EAMxx::IO::binary_restart");
+
+  // The staging fields may still be in use by the previous flush
+  finish_pending_flush();
+
+  const auto filename = compute_filename(timestamp);
+  const int rank   = m_comm.rank();
+  const int nranks = m_comm.size();
+
+  // Globals file, written by root only
+  std::string globals_buf;
+  if (m_comm.am_i_root()) {
+    globals_buf.append(magic,sizeof(magic)-1);
+    append(globals_buf,version);
+    append(globals_buf,nranks);
+    append_str(globals_buf,timestamp.to_string());
+    append(globals_buf,timestamp.get_num_steps());
+    append(globals_buf,static_cast<int>(m_globals.size()));
+    for (const auto& it : m_globals) {
+      const auto& name = it.first;
+      const auto& any  = it.second;
+      std::string payload;
+      GlobalType type;
+      if (any.isType<int>()) {
+        type = GlobalType::Int;
+        append(payload,ekat::any_cast<int>(any));
+      } else if (any.isType<std::int64_t>()) {
+        type = GlobalType::Int64;
+        append(payload,ekat::any_cast<std::int64_t>(any));
+      } else if (any.isType<float>()) {
+        type = GlobalType::Float;
+        append(payload,ekat::any_cast<float>(any));
+      } else if (any.isType<double>()) {
+        type = GlobalType::Double;
+        append(payload,ekat::any_cast<double>(any));
+      } else if (any.isType<std::string>()) {
+        type = GlobalType::String;
+        payload = ekat::any_cast<std::string>(any);
+      } else {
+        EKAT_ERROR_MSG (
+            "Error! Invalid concrete type for binary restart global.\n"
+            " - global name: " + name + "\n"
+            " - type id    : " + any.content().type().name() + "\n");
+      }
+      append_str(globals_buf,name);
+      append(globals_buf,static_cast<int>(type));
+      append_str(globals_buf,payload);
+    }
+    globals_buf.append(trailer,sizeof(trailer)-1);
+  }
+
+  // Rank file: copy fields in the staging buffers, and interleave their raw
+  // host data with the (small) metadata chunks. chunks[i] precedes data[i],
+  // while the last chunk closes the file.
+  start_timer("EAMxx::IO::binary_restart::stage");
+  std::vector<std::string> chunks(1);
+  std::vector<std::pair<const char*,long long>> data;
+  chunks[0].append(magic,sizeof(magic)-1);
+  append(chunks[0],version);
+  append(chunks[0],nranks);
+  append(chunks[0],rank);
+  append(chunks[0],static_cast<int>(m_grids.size()));
+  for (auto& sg : m_grids) {
+    auto& buf = chunks.back();
+    append_str(buf,sg.name);
+    append_str(buf,sg.part_dim_name);
+    append(buf,static_cast<int>(sg.gids.size()));
+    buf.append(reinterpret_cast<const char*>(sg.gids.data()),sg.gids.size()*sizeof(int));
+    append(buf,static_cast<int>(sg.fields.size()));
+    for (auto& sf : sg.fields) {
+      sf.staging.deep_copy<Device>(sf.src);
+      sf.staging.sync_to_host();
+
+      const auto& fh = sf.staging.get_header();
+      const auto& fl = fh.get_identifier().get_layout();
+      const auto& ap = fh.get_alloc_properties();
+      auto& hdr = chunks.back();
+      append_str(hdr,sf.src.name());
+      append(hdr,static_cast<int>(sf.staging.data_type()));
+      append(hdr,fl.rank());
+      for (int i=0; i<fl.rank(); ++i) {
+        append_str(hdr,sf.dim_names[i]);
+        append(hdr,fl.dim(i));
+      }
+      append(hdr,sf.part_dim);
+      append(hdr,fl.rank()>0 ? ap.get_last_extent() : 1);
+      append(hdr,static_cast<std::int64_t>(ap.get_alloc_size()));
+
+      data.emplace_back(sf.staging.get_internal_view_data<const char,Host>(),ap.get_alloc_size());
+      chunks.emplace_back();
+    }
+  }
+  chunks.back().append(trailer,sizeof(trailer)-1);
+  stop_timer("EAMxx::IO::binary_restart::stage");
+
+  // rpointer.atm is only updated once the flush is over (see finish_pending_flush). Until then,
+  // it must still point to the previous checkpoint, but history restart streams
+  // will append to it, so record its current content (and create it if needed).
+  if (m_comm.am_i_root()) {
+    std::ifstream ifs("rpointer.atm");
+    std::stringstream ss;
+    if (ifs.good()) {
+      ss << ifs.rdbuf();
+    } else {
+      std::ofstream rpointer("rpointer.atm");
+    }
+    m_rpointer_snapshot = ss.str();
+  }
+  m_pending_filename = filename;
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::binary_restart] - Writing model-restart:");
+    m_atm_logger->info("[EAMxx::binary_restart]      FILE: " + filename);
+  }
+
+  m_output_control.last_write_ts = timestamp;
+  m_output_control.compute_next_write_ts();
+
+  // Write to disk on a separate thread. The staging fields are not touched
+  // until the next checkpoint, and the AD waits for this flush to complete
+  // at the start of the next time step.
+  auto flush = [filename,rank,globals_buf=std::move(globals_buf),
+                chunks=std::move(chunks),data=std::move(data)] () {
+    auto write_file = [](const std::string& fname, const auto& write) {
+      std::ofstream ofs(fname,std::ios::binary | std::ios::trunc);
+      EKAT_REQUIRE_MSG (ofs.good(),
+          "Error! Could not open binary restart file for writing.\n"
+          " - file name: " + fname + "\n");
+      write(ofs);
+      ofs.close();
+      EKAT_REQUIRE_MSG (not ofs.fail(),
+          "Error! Something went wrong while writing binary restart file.\n"
+          " - file name: " + fname + "\n");
+    };
+    if (globals_buf.size()>0) {
+      write_file(filename,[&](std::ofstream& ofs) {
+        ofs.write(globals_buf.data(),globals_buf.size());
+      });
+    }
+    write_file(rank_filename(filename,rank),[&](std::ofstream& ofs) {
+      for (size_t i=0; i<data.size(); ++i) {
+        ofs.write(chunks[i].data(),chunks[i].size());
+        ofs.write(data[i].first,data[i].second);
+      }
+      ofs.write(chunks.back().data(),chunks.back().size());
+    });
+  };
+  m_pending_flush = std::async(std::launch::async,std::move(flush));
+
+  stop_timer("EAMxx::IO::binary_restart");
+}
+
+void BinaryRestartWriter::finalize ()
+{
+  finish_pending_flush();
+
+  m_grids.clear();
+  m_globals.clear();
+}
+
+// ========================== BinaryRestartReader ========================== //
+
+BinaryRestartReader::
+BinaryRestartReader (const std::string& filename,
+                     const ekat::Comm& comm)
+ : m_filename (filename)
+ , m_rank_filename (binary_restart::rank_filename(filename,comm.rank()))
+ , m_comm (comm)
+{
+  using namespace binary_restart;
+
+  EKAT_REQUIRE_MSG (is_binary_restart_file(filename),
+      "Error! Input file does not look like a binary restart file.\n"
+      " - file name: " + filename + "\n");
+
+  // The globals file is small: have root read it, and broadcast its content
+  std::string content;
+  if (m_comm.am_i_root()) {
+    std::ifstream ifs(m_filename,std::ios::binary);
+    EKAT_REQUIRE_MSG (ifs.good(),
+        "Error! Could not open binary restart file.\n"
+        " - file name: " + m_filename + "\n");
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    content = ss.str();
+  }
+  broadcast_string(content,m_comm,m_comm.root_rank());
+
+  std::istringstream gis(content);
+  check_tag(gis,magic,m_filename);
+  const auto file_version = extract<int>(gis,m_filename);
+  EKAT_REQUIRE_MSG (file_version==version,
+      "Error! Unsupported binary restart file version.\n"
+      " - file name   : " + m_filename + "\n"
+      " - file version: " + std::to_string(file_version) + "\n"
+      " - supported   : " + std::to_string(version) + "\n");
+  const auto nranks = extract<int>(gis,m_filename);
+  EKAT_REQUIRE_MSG (nranks==m_comm.size(),
+      "Error! Binary restart files can only be read with the same number of ranks they were written with.\n"
+      " - file name    : " + m_filename + "\n"
+      " - file nranks  : " + std::to_string(nranks) + "\n"
+      " - comm size    : " + std::to_string(m_comm.size()) + "\n"
+      " Use scripts/binary-restart-to-nc to convert the checkpoint to a NetCDF restart file.\n");
+  m_timestamp = util::str_to_time_stamp(extract_str(gis,m_filename));
+  m_nsteps = extract<int>(gis,m_filename);
+  const auto nglobals = extract<int>(gis,m_filename);
+  for (int i=0; i<nglobals; ++i) {
+    auto name = extract_str(gis,m_filename);
+    auto& g = m_globals[name];
+    g.type  = static_cast<GlobalType>(extract<int>(gis,m_filename));
+    g.bytes = extract_str(gis,m_filename);
+  }
+  check_tag(gis,trailer,m_filename);
+
+  // Index this rank's file, so we can later read fields in any order
+  std::ifstream ifs(m_rank_filename,std::ios::binary);
+  EKAT_REQUIRE_MSG (ifs.good(),
+      "Error! Could not open binary restart file.\n"
+      " - file name: " + m_rank_filename + "\n");
+  check_tag(ifs,magic,m_rank_filename);
+  EKAT_REQUIRE_MSG (extract<int>(ifs,m_rank_filename)==version and
+                    extract<int>(ifs,m_rank_filename)==nranks and
+                    extract<int>(ifs,m_rank_filename)==m_comm.rank(),
+      "Error! Binary restart rank file is not consistent with the globals file.\n"
+      " - globals file: " + m_filename + "\n"
+      " - rank file   : " + m_rank_filename + "\n");
+  const auto ngrids = extract<int>(ifs,m_rank_filename);
+  for (int ig=0; ig<ngrids; ++ig) {
+    auto gname = extract_str(ifs,m_rank_filename);
+    auto& ge = m_grids[gname];
+    extract_str(ifs,m_rank_filename); // Partitioned dim name, only needed for conversion to NetCDF
+    const auto ngids = extract<int>(ifs,m_rank_filename);
+    ge.gids.resize(ngids);
+    ifs.read(reinterpret_cast<char*>(ge.gids.data()),ngids*sizeof(int));
+    const auto nfields = extract<int>(ifs,m_rank_filename);
+    for (int ifield=0; ifield<nfields; ++ifield) {
+      auto fname = extract_str(ifs,m_rank_filename);
+      auto& fe = ge.fields[fname];
+      fe.data_type = static_cast<DataType>(extract<int>(ifs,m_rank_filename));
+      const auto rank = extract<int>(ifs,m_rank_filename);
+      for (int i=0; i<rank; ++i) {
+        extract_str(ifs,m_rank_filename); // Dim name, only needed for conversion to NetCDF
+        fe.dims.push_back(extract<int>(ifs,m_rank_filename));
+      }
+      extract<int>(ifs,m_rank_filename); // Partitioned dim, only needed for conversion to NetCDF
+      fe.last_extent = extract<int>(ifs,m_rank_filename);
+      fe.nbytes = extract<std::int64_t>(ifs,m_rank_filename);
+      fe.offset = ifs.tellg();
+      ifs.seekg(fe.nbytes,std::ios::cur);
+    }
+  }
+  check_tag(ifs,trailer,m_rank_filename);
+}
+
+auto BinaryRestartReader::
+get_global_entry (const std::string& name) const -> const GlobalEntry&
+{
+  EKAT_REQUIRE_MSG (has_global(name),
+      "Error! Global not found in binary restart file.\n"
+      " - file name  : " + m_filename + "\n"
+      " - global name: " + name + "\n");
+  return m_globals.at(name);
+}
+
+void BinaryRestartReader::
+read_fields (const std::vector<Field>& fields,
+             const std::shared_ptr<const AbstractGrid>& grid)
+{
+  EKAT_REQUIRE_MSG (m_grids.count(grid->name())==1,
+      "Error! Grid not found in binary restart file.\n"
+      " - file name: " + m_rank_filename + "\n"
+      " - grid name: " + grid->name() + "\n");
+  const auto& ge = m_grids.at(grid->name());
+
+  // Raw data is only meaningful if the grid decomposition did not change
+  const int nlocal = grid->get_partitioned_dim_local_size();
+  auto gids_h = grid->get_partitioned_dim_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  bool same_gids = static_cast<int>(ge.gids.size())==nlocal;
+  for (int i=0; same_gids and i<nlocal; ++i) {
+    same_gids = ge.gids[i]==gids_h[i];
+  }
+  EKAT_REQUIRE_MSG (same_gids,
+      "Error! Grid decomposition differs from the one stored in the binary restart file.\n"
+      " - file name: " + m_rank_filename + "\n"
+      " - grid name: " + grid->name() + "\n");
+
+  std::ifstream ifs(m_rank_filename,std::ios::binary);
+  EKAT_REQUIRE_MSG (ifs.good(),
+      "Error! Could not open binary restart file.\n"
+      " - file name: " + m_rank_filename + "\n");
+
+  for (const auto& f : fields) {
+    const auto& fname = f.name();
+    EKAT_REQUIRE_MSG (ge.fields.count(fname)==1,
+        "Error! Field not found in binary restart file.\n"
+        " - file name : " + m_rank_filename + "\n"
+        " - grid name : " + grid->name() + "\n"
+        " - field name: " + fname + "\n");
+    const auto& fe = ge.fields.at(fname);
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    EKAT_REQUIRE_MSG (fe.data_type==f.data_type() and fe.dims==fl.dims(),
+        "Error! Field stored in binary restart file does not match the model field.\n"
+        " - file name  : " + m_rank_filename + "\n"
+        " - field name : " + fname + "\n"
+        " - field dtype: " + e2str(f.data_type()) + "\n"
+        " - file dtype : " + e2str(fe.data_type) + "\n"
+        " - field dims : (" + ekat::join(fl.dims(),",") + ")\n"
+        " - file dims  : (" + ekat::join(fe.dims,",") + ")\n");
+
+    // Read in a standalone copy, which is contiguous even if f is a subfield
+    auto tmp = f.clone();
+    const auto& ap = tmp.get_header().get_alloc_properties();
+    auto tmp_data = tmp.get_internal_view_data<char,Host>();
+    const int last_extent = fl.rank()>0 ? ap.get_last_extent() : 1;
+
+    ifs.seekg(fe.offset);
+    if (last_extent==fe.last_extent) {
+      EKAT_REQUIRE_MSG (fe.nbytes==ap.get_alloc_size(),
+          "Error! Unexpected allocation size for field in binary restart file.\n"
+          " - file name : " + m_rank_filename + "\n"
+          " - field name: " + fname + "\n");
+      ifs.read(tmp_data,fe.nbytes);
+    } else {
+      // The pack size changed: copy one row (along the last dim) at a time, skipping padding
+      const int type_size = get_type_size(fe.data_type);
+      const long long src_row = static_cast<long long>(fe.last_extent)*type_size;
+      const long long tgt_row = static_cast<long long>(last_extent)*type_size;
+      const long long nrows = fe.nbytes / src_row;
+      const long long ncopy = static_cast<long long>(fl.dims().back())*type_size;
+      std::vector<char> row(src_row);
+      for (long long irow=0; irow<nrows; ++irow) {
+        ifs.read(row.data(),src_row);
+        std::memcpy(tmp_data+irow*tgt_row,row.data(),ncopy);
+      }
+    }
+    EKAT_REQUIRE_MSG (ifs.good(),
+        "Error! Something went wrong while reading field from binary restart file.\n"
+        " - file name : " + m_rank_filename + "\n"
+        " - field name: " + fname + "\n");
+
+    tmp.sync_to_dev();
+    auto f_nc = f;
+    f_nc.deep_copy<Device>(tmp);
+    f_nc.deep_copy<Host>(tmp);
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,230 @@
+#ifndef EAMXX_BINARY_RESTART_HPP
+#define EAMXX_BINARY_RESTART_HPP
+
+#include "share/io/scream_io_control.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/logging/ekat_logger.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/std_meta/ekat_std_any.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Fast path for model restart files.
+ *
+ * Instead of going through scorpio, each rank dumps the raw content of all
+ * the fields in the RESTART group(s) to its own binary file. The raw bytes are
+ * copied verbatim (including padding), so restarting from a binary checkpoint
+ * is BFB with restarting from a NetCDF one.
+ *
+ * A checkpoint named <prefix>.r.INSTANT.<units>_x<freq>.<ts>.bin consists of
+ *  - the file <name>, written by the root rank, storing the checkpoint globals
+ *    (number of ranks, time stamp, nsteps, and any global added via add_global);
+ *  - the files <name>.<rank> (rank zero-padded to 6 digits), one per rank, storing
+ *    the partitioned dim gids of each grid, and, for each field, its name, data
+ *    type, dimensions, and raw data.
+ * All integers are stored in native byte order. Each file starts with a magic
+ * string and ends with a trailer, so that truncated files can be detected.
+ *
+ * Upon a write step, fields are copied in persistent staging fields and synced
+ * to host, after which the actual write to disk happens on a separate thread,
+ * overlapped with the rest of the atm time step. The AD completes a pending
+ * flush at the start of the following time step (see finish_pending_flush).
+ * Only then, if the flush succeeded on all ranks, rpointer.atm is updated to
+ * point to the new checkpoint, so that the previous checkpoint is still used
+ * if the job dies during the flush.
+ *
+ * Since each rank only stores its own portion of the fields, restarting from
+ * a binary checkpoint requires the same number of ranks and the same grids
+ * decomposition. Use scripts/binary-restart-to-nc to convert the checkpoint
+ * to a NetCDF file.
+ */
+
+namespace binary_restart {
+
+constexpr char magic   [] = "EAMXXRST";
+constexpr char trailer [] = "EAMXXEND";
+constexpr int  version    = 1;
+
+// The rank-file name for a given checkpoint name
+std::string rank_filename (const std::string& filename, const int rank);
+
+// Whether the given (model restart) file name refers to a binary checkpoint
+bool is_binary_restart_file (const std::string& filename);
+
+// Type tags for the checkpoint globals
+enum class GlobalType : int {
+  Int    = 0,
+  Int64  = 1,
+  Float  = 2,
+  Double = 3,
+  String = 4
+};
+
+} // namespace binary_restart
+
+class BinaryRestartWriter
+{
+public:
+  using fm_type = FieldManager;
+  using globals_map_t = std::map<std::string,ekat::any>;
+
+  // Inputs:
+  //  - comm: the atm comm
+  //  - params: the model restart parameter list (needs filename_prefix and output_control)
+  //  - field_mgrs: the field managers; only fields in the RESTART group are saved
+  //  - run_t0: the timestamp of the start of the current simulation
+  BinaryRestartWriter (const ekat::Comm& comm,
+                       const ekat::ParameterList& params,
+                       const std::map<std::string,std::shared_ptr<fm_type>>& field_mgrs,
+                       const util::TimeStamp& run_t0);
+
+  ~BinaryRestartWriter ();
+
+  void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
+    m_atm_logger = atm_logger;
+  }
+  void add_global (const std::string& name, const ekat::any& global);
+
+  void run (const util::TimeStamp& timestamp);
+  void finalize ();
+
+  // Wait for the pending flush (if any) to complete on all ranks, then update
+  // rpointer.atm. Rethrows exceptions from the flush thread. Must be called
+  // by all ranks.
+  void finish_pending_flush ();
+
+  const IOControl& get_output_control () const { return m_output_control; }
+
+protected:
+
+  std::string compute_filename (const util::TimeStamp& timestamp) const;
+
+  // ON ROOT, points rpointer.atm to the pending checkpoint
+  void update_rpointer ();
+
+  struct StagedField {
+    Field                     src;
+    Field                     staging;
+    std::vector<std::string>  dim_names;
+    int                       part_dim;   // Index of the partitioned dim in the layout (-1 if not partitioned)
+  };
+
+  struct StagedGrid {
+    std::string                 name;
+    std::string                 part_dim_name;
+    std::vector<int>            gids;
+    std::vector<StagedField>    fields;
+  };
+
+  ekat::Comm                m_comm;
+  std::string               m_filename_prefix;
+  IOControl                 m_output_control;
+
+  std::vector<StagedGrid>   m_grids;
+  globals_map_t             m_globals;
+
+  std::future<void>         m_pending_flush;
+  std::string               m_pending_filename;
+  std::string               m_rpointer_snapshot;  // rpointer.atm content when the pending checkpoint was staged
+
+  std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
+};
+
+class BinaryRestartReader
+{
+public:
+  using GlobalType = binary_restart::GlobalType;
+
+  BinaryRestartReader (const std::string& filename,
+                       const ekat::Comm& comm);
+
+  // Read the given fields (all defined on the given grid) from this rank's file
+  void read_fields (const std::vector<Field>& fields,
+                    const std::shared_ptr<const AbstractGrid>& grid);
+
+  bool has_global (const std::string& name) const { return m_globals.count(name)==1; }
+
+  template<typename T>
+  T get_global (const std::string& name) const;
+
+  const util::TimeStamp& get_timestamp () const { return m_timestamp; }
+  int get_num_steps () const { return m_nsteps; }
+
+protected:
+
+  struct GlobalEntry {
+    GlobalType  type;
+    std::string bytes;
+  };
+
+  struct FieldEntry {
+    DataType          data_type;
+    std::vector<int>  dims;
+    int               last_extent;
+    long long         nbytes;
+    std::streamoff    offset;
+  };
+
+  struct GridEntry {
+    std::vector<int>                    gids;
+    std::map<std::string,FieldEntry>    fields;
+  };
+
+  const GlobalEntry& get_global_entry (const std::string& name) const;
+
+  std::string       m_filename;
+  std::string       m_rank_filename;
+  ekat::Comm        m_comm;
+
+  util::TimeStamp   m_timestamp;
+  int               m_nsteps;
+
+  std::map<std::string,GlobalEntry> m_globals;
+  std::map<std::string,GridEntry>   m_grids;
+};
+
+template<typename T>
+T BinaryRestartReader::get_global (const std::string& name) const
+{
+  const auto& g = get_global_entry(name);
+  if constexpr (std::is_same<T,std::string>::value) {
+    EKAT_REQUIRE_MSG (g.type==GlobalType::String,
+        "Error! Binary restart global '" + name + "' is not a string.\n");
+    return g.bytes;
+  } else {
+    GlobalType expected;
+    if constexpr (std::is_same<T,int>::value) {
+      expected = GlobalType::Int;
+    } else if constexpr (std::is_same<T,std::int64_t>::value) {
+      expected = GlobalType::Int64;
+    } else if constexpr (std::is_same<T,float>::value) {
+      expected = GlobalType::Float;
+    } else {
+      static_assert (std::is_same<T,double>::value,
+          "Error! Unsupported type for binary restart globals.\n");
+      expected = GlobalType::Double;
+    }
+    EKAT_REQUIRE_MSG (g.type==expected and g.bytes.size()==sizeof(T),
+        "Error! Type mismatch when reading binary restart global '" + name + "'.\n");
+    T value;
+    std::memcpy(&value,g.bytes.data(),sizeof(T));
+    return value;
+  }
+}
+
+} // namespace scream
+
+#endif // EAMXX_BINARY_RESTART_HPP
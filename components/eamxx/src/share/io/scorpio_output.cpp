@@ -2,6 +2,7 @@
 #include "share/io/scorpio_input.hpp"
 #include "share/util/scream_array_utils.hpp"
 #include "share/grid/remap/coarsening_remapper.hpp"
+#include "share/grid/remap/column_subset_remapper.hpp"
 #include "share/grid/remap/vertical_remapper.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/field/field_utils.hpp"
@@ -170,17 +171,22 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   sort_and_check(m_fields_names);
 
   // Check if remapping and if so create the appropriate remapper
-  // Note: We currently support three remappers
+  // Note: We currently support four remappers
   //   - vertical remapping from file
   //   - horizontal remapping from file
+  //   - column subset (closest columns to a list of lat/lon locations)
   //   - online remapping which is setup using the create_remapper function
   const bool use_vertical_remap_from_file = params.isParameter("vertical_remap_file");
   const bool use_horiz_remap_from_file = params.isParameter("horiz_remap_file");
+  const bool use_column_subset = params.isParameter("column_subset_lat");
   const bool use_online_remapper = io_grid->name()!=fm_grid->name();  // TODO: QUESTION, Do we anticipate online remapping w/ horiz_remap_from file?
   // Check that we are not requesting online remapping w/ horiz and/or vertical remapping.  Which is not currently supported.
   if (use_online_remapper) {
-    EKAT_REQUIRE_MSG(!use_vertical_remap_from_file and !use_horiz_remap_from_file,"ERROR: scorpio_output - online remapping not supported with vertical and/or horizontal remapping from file");
+    EKAT_REQUIRE_MSG(!use_vertical_remap_from_file and !use_horiz_remap_from_file and !use_column_subset,
+        "ERROR: scorpio_output - online remapping not supported with vertical and/or horizontal remapping from file, or column subset");
   }
+  EKAT_REQUIRE_MSG(!use_horiz_remap_from_file or !use_column_subset,
+      "ERROR: scorpio_output - horizontal remapping from file not supported with column subset");
 
   // Try to set the IO grid (checks will be performed)
   set_grid (io_grid);
@@ -271,7 +277,7 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   }
 
   // Online remapper and horizontal remapper follow a similar pattern so we check in the same conditional.
-  if (use_online_remapper || use_horiz_remap_from_file) {
+  if (use_online_remapper || use_horiz_remap_from_file || use_column_subset) {
 
     // Whic FM is the one pre-horiz-remap depends on whether we did vert remap or not
     const auto fm_pre_hremap = use_vertical_remap_from_file
@@ -286,6 +292,18 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
       m_horiz_remapper = std::make_shared<CoarseningRemapper>(io_grid,horiz_remap_file,true);
       io_grid = m_horiz_remapper->get_tgt_grid();
       set_grid(io_grid);
+    } else if (use_column_subset) {
+      // Construct the column subset remapper. The closest columns are searched on device,
+      // and fields are gathered on device, so only the selected columns are copied to host.
+      EKAT_REQUIRE_MSG (params.isParameter("column_subset_lon"),
+          "Error! Output parameter 'column_subset_lat' requires 'column_subset_lon' as well.\n");
+      const auto lats = params.get<std::vector<double>>("column_subset_lat");
+      const auto lons = params.get<std::vector<double>>("column_subset_lon");
+      m_horiz_remapper = std::make_shared<ColumnSubsetRemapper>(io_grid,
+                                                                std::vector<Real>(lats.begin(),lats.end()),
+                                                                std::vector<Real>(lons.begin(),lons.end()));
+      io_grid = m_horiz_remapper->get_tgt_grid();
+      set_grid(io_grid);
     } else {
       // Construct a generic remapper (likely, SE->Point)
       m_horiz_remapper = grids_mgr->create_remapper(fm_grid,io_grid);
@@ -45,6 +45,8 @@
  *  Restart:
  *    filename_prefix:            STRING                (default: ${filename_prefix})
  *    Perform Restart:            BOOL                  (default: true)
+ *  column_subset_lat:            ARRAY OF DOUBLES      (optional)
+ *  column_subset_lon:            ARRAY OF DOUBLES      (optional)
  *  -----
  *  The meaning of these parameters is the following:
  *  - filename_prefix: the output filename root.
@@ -75,6 +77,9 @@
  *    - Perform Restart: if this is a restarted run, and Averaging Type is not Instant, this flag
  *      determines whether we want to restart the output history or start from scrach. That is,
  *      you can set this to false to force a fresh new history, even in a restarted run.
+ *  - column_subset_lat/column_subset_lon: if provided, only output the columns closest to these
+ *    lat/lon locations (in degrees), e.g. to output a list of observation sites. The closest
+ *    columns are found once, at construction, and the output file has one column per location.
 
  *  Notes:
  *   - you can specify lists with either of the two syntaxes:
@@ -22,13 +22,14 @@ std::string find_filename_in_rpointer (
     std::string line;
     rpointer_file.open("rpointer.atm");
 
-    // If the timestamp is in the filename, then the filename ends with "S.nc",
-    // with S being the string representation of the timestamp
+    // If the timestamp is in the filename, then the filename ends with "S.ext",
+    // with S being the string representation of the timestamp, and ext being
+    // the file extension (nc for NetCDF files, bin for binary model restarts)
     auto ts_len = run_t0.to_string().size();
     auto extract_ts = [&] (const std::string& line) -> util::TimeStamp {
-      auto min_size = ts_len+3;
-      if (line.size()>=min_size) {
-        auto ts_str = line.substr(line.size()-min_size,ts_len);
+      auto ext_pos = line.rfind('.');
+      if (ext_pos!=std::string::npos and ext_pos>=ts_len) {
+        auto ts_str = line.substr(ext_pos-ts_len,ts_len);
         auto ts = util::str_to_time_stamp(ts_str);
         return ts;
       } else {
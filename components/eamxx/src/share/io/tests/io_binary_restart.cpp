@@ -0,0 +1,188 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_binary_restart.hpp"
+#include "share/io/scream_io_utils.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+namespace scream {
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int pack_size, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_real_distribution<Real> pdf (0,1);
+    return pdf(engine);
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  std::vector<FL> layouts =
+  {
+    FL({COL         }, {nlcols        }),
+    FL({COL,     LEV}, {nlcols,  nlevs}),
+    FL({COL,CMP,ILEV}, {nlcols,2,nlevs+1})
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  fm->registration_ends();
+
+  const auto units = ekat::units::Units::nondimensional();
+  int count=0;
+  for (const auto& fl : layouts) {
+    FID fid("f_"+std::to_string(count),fl,units,grid->name());
+    Field f(fid);
+    // Use packs on all but the first field, to test padding is handled correctly
+    f.get_header().get_alloc_properties().request_allocation(count==0 ? 1 : pack_size);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    fm->add_to_group(f.name(),"RESTART");
+    ++count;
+  }
+
+  return fm;
+}
+
+TEST_CASE ("io_binary_restart") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto seed = get_random_test_seed(&comm);
+
+  // For 2+ ranks tests, this will check IO works correctly
+  // even if one rank owns 0 dofs
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs = 5;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  util::TimeStamp t0({2023,2,17},{0,0,0});
+  const int dt = 10;
+  const int freq = 2;
+
+  // Write a few checkpoints, changing fields in between
+  auto fm_out = get_fm(grid,t0,4,seed);
+  std::map<std::string,std::shared_ptr<FieldManager>> fms = {{grid->name(),fm_out}};
+
+  ekat::ParameterList params;
+  params.set<std::string>("filename_prefix","io_binary_restart.np"+std::to_string(comm.size()));
+  params.sublist("output_control").set<std::string>("frequency_units","nsteps");
+  params.sublist("output_control").set("Frequency",freq);
+
+  BinaryRestartWriter writer(comm,params,fms,t0);
+  ekat::any counter, label;
+  counter.reset<int>(0);
+  label.reset<std::string>("");
+  writer.add_global("counter",counter);
+  writer.add_global("label",label);
+
+  std::mt19937_64 engine(seed+1);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_real_distribution<Real> pdf (0,1);
+    return pdf(engine);
+  };
+
+  // Start from a clean rpointer.atm
+  const auto prefix = params.get<std::string>("filename_prefix");
+  if (comm.am_i_root()) {
+    std::remove("rpointer.atm");
+  }
+  comm.barrier();
+
+  auto t = t0;
+  auto t_prev = t0;
+  const int nsteps = 2*freq;
+  std::map<std::string,Field> expected;
+  for (int n=0; n<nsteps; ++n) {
+    // Like the AD, complete the pending flush at the start of the step
+    writer.finish_pending_flush();
+    if (n>0 and n%freq==0) {
+      // The checkpoint from the previous step must now be in rpointer.atm
+      REQUIRE_NOTHROW (find_filename_in_rpointer(prefix,true,comm,t_prev));
+    }
+
+    t += dt;
+    for (const auto& it : *fm_out) {
+      randomize(*it.second,engine,my_pdf);
+    }
+    ekat::any_cast<int>(counter) = n;
+    ekat::any_cast<std::string>(label) = "step " + std::to_string(n);
+    writer.run(t);
+
+    if ((n+1)%freq==0) {
+      // The checkpoint may still be flushing, so rpointer.atm must not point to it yet
+      REQUIRE_THROWS (find_filename_in_rpointer(prefix,true,comm,t));
+      // Mimic a history restart stream, which appends to rpointer.atm
+      if (comm.am_i_root()) {
+        std::ofstream rpointer("rpointer.atm",std::ofstream::app);
+        rpointer << prefix << "_hist.rhist." << t.to_string() << ".nc" << std::endl;
+      }
+      comm.barrier();
+      t_prev = t;
+    }
+
+    if (n==nsteps-1) {
+      for (const auto& it : *fm_out) {
+        expected[it.first] = it.second->clone();
+      }
+    }
+    // Changing fields right after the checkpoint must not alter it
+    for (const auto& it : *fm_out) {
+      it.second->deep_copy(-1.0);
+    }
+  }
+  writer.finalize();
+
+  // The last checkpoint is the one in rpointer.atm, and the history
+  // restart entries appended during its flush were preserved
+  auto filename = find_filename_in_rpointer(prefix,true,comm,t);
+  REQUIRE (binary_restart::is_binary_restart_file(filename));
+  REQUIRE_NOTHROW (find_filename_in_rpointer(prefix+"_hist",false,comm,t));
+
+  // Read back, with a different pack size
+  auto fm_in = get_fm(grid,t0,1,-seed-1);
+  BinaryRestartReader reader(filename,comm);
+  REQUIRE (reader.get_timestamp()==t);
+  REQUIRE (reader.get_num_steps()==t.get_num_steps());
+  REQUIRE (reader.get_global<int>("counter")==nsteps-1);
+  REQUIRE (reader.get_global<std::string>("label")=="step "+std::to_string(nsteps-1));
+  REQUIRE_THROWS (reader.get_global<double>("counter"));
+  REQUIRE_THROWS (reader.get_global<int>("foo"));
+
+  std::vector<Field> fields;
+  for (const auto& it : *fm_in) {
+    fields.push_back(*it.second);
+  }
+  reader.read_fields(fields,grid);
+  for (const auto& f : fields) {
+    REQUIRE (views_are_equal(f,expected.at(f.name())));
+  }
+}
+
+} // namespace scream
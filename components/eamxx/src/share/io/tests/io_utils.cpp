@@ -20,6 +20,7 @@ TEST_CASE ("find_filename_in_rpointer") {
   rpointer << "foo.r." + t0.to_string() + ".nc\n";
   rpointer << "bar2.rhist." + t0.to_string() + ".nc\n";
   rpointer << "bar.rhist." + t0.to_string() + ".nc\n";
+  rpointer << "baz.r.INSTANT.nsteps_x2." + t0.to_string() + ".bin\n";
   rpointer.close();
 
   // Now test find_filename_in_rpointer with different inputs
@@ -32,6 +33,7 @@ TEST_CASE ("find_filename_in_rpointer") {
   REQUIRE (find_filename_in_rpointer("bar", false,comm,t0)==("bar.rhist."+t0.to_string()+".nc"));
   REQUIRE (find_filename_in_rpointer("bar2",false,comm,t0)==("bar2.rhist."+t0.to_string()+".nc"));
   REQUIRE (find_filename_in_rpointer("foo", true, comm,t0)==("foo.r."+t0.to_string()+".nc"));
+  REQUIRE (find_filename_in_rpointer("baz", true, comm,t0)==("baz.r.INSTANT.nsteps_x2."+t0.to_string()+".bin"));
 }
 
 TEST_CASE ("io_control") {
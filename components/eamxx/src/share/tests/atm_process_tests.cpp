@@ -304,6 +304,30 @@ public:
   }
 };
 
+// Like Bar, but does not write anything Bar reads/writes, so it can run concurrently with it
+class Qux : public DummyProcess
+{
+public:
+  Qux (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto phys_lt = grid->get_3d_scalar_layout (true);
+
+    add_field<Required>("Temperature",phys_lt,K,m_grid_name);
+    add_field<Computed>("Concentration B",phys_lt,kg/pow(m,3),m_grid_name);
+  }
+};
+
 class AddOne : public DummyProcess
 {
 public:
@@ -459,6 +483,64 @@ TEST_CASE("atm_proc_dag", "") {
 
     REQUIRE (dag.has_unmet_dependencies());
   }
+
+  SECTION ("schedule") {
+    using strvec_t = std::vector<std::string>;
+    factory.register_product("Qux",&create_atmosphere_process<Qux>);
+
+    auto params = create_test_params();
+    auto& p1 = params.sublist("BarBaz");
+    p1.set<strvec_t>("atm_procs_list",{"Bar","Qux","Baz"});
+    auto& p1_2 = p1.sublist("Qux");
+    p1_2.set<std::string>("Type", "Qux");
+    p1_2.set<std::string>("Grid Name", "Point Grid");
+
+    std::shared_ptr<AtmosphereProcess> atm_process (factory.create("group",comm,params));
+    atm_process->set_grids(gm);
+    create_and_set_fields (*atm_process);
+
+    AtmProcDAG dag;
+    dag.create_dag(*std::dynamic_pointer_cast<AtmosphereProcessGroup>(atm_process));
+
+    // Foo -> {Bar,Qux}, and Bar -> Baz
+    const auto& plan = dag.get_execution_plan();
+    REQUIRE (plan.size()==4);
+    REQUIRE (dag.get_num_levels()==3);
+    REQUIRE (plan[0].name=="Foo");
+    REQUIRE (plan[0].level==0);
+    REQUIRE (plan[1].level==1);
+    REQUIRE (plan[2].level==1);
+    REQUIRE (plan[3].level==2);
+    REQUIRE (plan[3].depends_on==std::vector<int>{0,1});
+
+    const auto sets = dag.get_concurrent_sets();
+    REQUIRE (sets.size()==3);
+    REQUIRE (sets[1]==std::vector<int>{1,2});
+
+    // Baz reads Temperature, computed by Foo two levels earlier,
+    // so it can be prefetched while Bar and Qux run
+    REQUIRE (plan[1].prefetch.size()==0);
+    REQUIRE (plan[3].reads.size()==2);
+    REQUIRE (plan[3].prefetch.size()==1);
+    REQUIRE (dag.get_fids()[plan[3].prefetch[0]].name()=="Temperature");
+
+    // Critical path: Foo, Bar, Baz (Qux alone is shorter)
+    std::map<std::string,double> costs = {{"Foo",1.0},{"Bar",2.0},{"Qux",3.0}};
+    dag.set_costs(costs);
+    REQUIRE (dag.get_critical_path_cost()<0);
+    costs["Baz"] = 1.5;
+    dag.set_costs(costs);
+    REQUIRE (dag.get_critical_path_cost()==4.5);
+    REQUIRE (plan[0].on_critical_path);
+    REQUIRE (plan[1].on_critical_path);
+    REQUIRE (not plan[2].on_critical_path);
+    REQUIRE (plan[3].on_critical_path);
+
+    // Costs survive a round trip through the schedule file
+    dag.write_schedule("atm_proc_schedule.yaml");
+    REQUIRE (AtmProcDAG::read_schedule_costs("atm_proc_schedule.yaml")==costs);
+    REQUIRE (AtmProcDAG::read_schedule_costs("missing_atm_proc_schedule.yaml").size()==0);
+  }
 }
 
 TEST_CASE("field_checks", "") {
@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include "share/grid/remap/column_subset_remapper.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/field/field_utils.hpp"
+
+namespace scream {
+
+TEST_CASE ("column_subset_remapper") {
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Create a src grid, with columns along a spiral from south to north
+  const int ngcols = 8*comm.size();
+  const int nlevs = std::max(SCREAM_PACK_SIZE,16);
+  auto src_grid = create_point_grid("src",ngcols,nlevs,comm);
+  const int nlcols = src_grid->get_num_local_dofs();
+
+  auto gid2lat = [&](const int gid) { return -80 + 160*Real(gid)/(ngcols-1); };
+  auto gid2lon = [&](const int gid) { return std::fmod(Real(45*gid),Real(360)); };
+
+  const auto u = ekat::units::Units::nondimensional();
+  auto lat = src_grid->create_geometry_data("lat",src_grid->get_2d_scalar_layout(),u);
+  auto lon = src_grid->create_geometry_data("lon",src_grid->get_2d_scalar_layout(),u);
+  auto gids_h = src_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto lat_h = lat.get_view<Real*,Host>();
+  auto lon_h = lon.get_view<Real*,Host>();
+  for (int i=0; i<nlcols; ++i) {
+    lat_h(i) = gid2lat(gids_h(i));
+    lon_h(i) = gid2lon(gids_h(i));
+  }
+  lat.sync_to_dev();
+  lon.sync_to_dev();
+
+  // Target locations: slightly perturbed columns, one of them twice (the
+  // second time across the 0/360 longitude seam from the column)
+  std::vector<int> expected_gids = {ngcols-1, 0, 3, 0};
+  std::vector<Real> tgt_lats, tgt_lons;
+  for (auto gid : expected_gids) {
+    tgt_lats.push_back(gid2lat(gid)+0.1);
+    tgt_lons.push_back(gid2lon(gid)+0.1);
+  }
+  tgt_lons[3] = 359.9;
+
+  // Bad inputs
+  REQUIRE_THROWS (ColumnSubsetRemapper(src_grid,{0.0},{}));
+  REQUIRE_THROWS (ColumnSubsetRemapper(src_grid,{100.0},{0.0}));
+
+  ColumnSubsetRemapper remapper(src_grid,tgt_lats,tgt_lons);
+  auto tgt_grid = remapper.get_tgt_grid();
+  REQUIRE (tgt_grid->get_num_global_dofs()==static_cast<int>(expected_gids.size()));
+  REQUIRE (tgt_grid->is_unique());
+
+  // Fields to remap (use packs on the 3d field, to check padding is handled)
+  Field src_2d (FieldIdentifier("f2d",src_grid->get_2d_scalar_layout(),u,src_grid->name()));
+  Field src_3d (FieldIdentifier("f3d",src_grid->get_3d_vector_layout(true,2),u,src_grid->name()));
+  src_3d.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+  src_2d.allocate_view();
+  src_3d.allocate_view();
+  auto src_2d_h = src_2d.get_view<Real*,Host>();
+  auto src_3d_h = src_3d.get_view<Real***,Host>();
+  for (int i=0; i<nlcols; ++i) {
+    src_2d_h(i) = gids_h(i);
+    for (int j=0; j<2; ++j) {
+      for (int k=0; k<nlevs; ++k) {
+        src_3d_h(i,j,k) = gids_h(i)*1000 + j*100 + k;
+      }
+    }
+  }
+  src_2d.sync_to_dev();
+  src_3d.sync_to_dev();
+
+  remapper.registration_begins();
+  remapper.register_field_from_src(src_2d.get_header().get_identifier());
+  remapper.register_field_from_src(src_3d.get_header().get_identifier());
+  remapper.registration_ends();
+
+  Field tgt_2d (remapper.get_tgt_field_id(0));
+  Field tgt_3d (remapper.get_tgt_field_id(1));
+  tgt_2d.allocate_view();
+  tgt_3d.allocate_view();
+  remapper.bind_field(src_2d,tgt_2d);
+  remapper.bind_field(src_3d,tgt_3d);
+
+  remapper.remap(true);
+  REQUIRE_THROWS (remapper.remap(false));
+
+  tgt_2d.sync_to_host();
+  tgt_3d.sync_to_host();
+  auto tgt_gids_h = tgt_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto tgt_lat = tgt_grid->get_geometry_data("lat");
+  tgt_lat.sync_to_host();
+  auto tgt_lat_h = tgt_lat.get_view<const Real*,Host>();
+  auto tgt_2d_h = tgt_2d.get_view<const Real*,Host>();
+  auto tgt_3d_h = tgt_3d.get_view<const Real***,Host>();
+  for (int i=0; i<tgt_grid->get_num_local_dofs(); ++i) {
+    const int src_gid = expected_gids[tgt_gids_h(i)];
+    REQUIRE (tgt_lat_h(i)==gid2lat(src_gid));
+    REQUIRE (tgt_2d_h(i)==src_gid);
+    for (int j=0; j<2; ++j) {
+      for (int k=0; k<nlevs; ++k) {
+        REQUIRE (tgt_3d_h(i,j,k)==src_gid*1000 + j*100 + k);
+      }
+    }
+  }
+}
+
+} // namespace scream
@@ -7,6 +7,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_lincomb.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 
 #include "share/grid/point_grid.hpp"
@@ -812,4 +813,142 @@ TEST_CASE ("update") {
   }
 }
 
+TEST_CASE ("lincomb") {
+  using namespace scream;
+  using namespace ekat::units;
+
+  using namespace ShortFieldTagsNames;
+  using RPDF = std::uniform_real_distribution<Real>;
+
+  // Setup random number generation
+  auto engine = setup_random_test ();
+  RPDF rpdf(0,1);
+
+  const int ncol = 2;
+  const int ncmp = 3;
+  const int nlev = 4;
+
+  std::vector<FieldTag> tags = {COL, CMP, LEV};
+  std::vector<int>      dims = {ncol,ncmp,nlev};
+
+  FieldIdentifier fid ("f", {tags,dims}, kg, "some_grid");
+  Field f0 (fid);
+  f0.allocate_view();
+  randomize (f0,engine,rpdf);
+  Field f1 = f0.clone();
+  randomize (f1,engine,rpdf);
+
+  SECTION ("assign") {
+    Field y  = f0.clone();
+    Field y2 = f0.clone();
+
+    // y = 2*f0 - f1, in one kernel vs deep_copy+update
+    evaluate(y, Real(2)*f0 - Real(1)*f1);
+    y2.deep_copy(f0);
+    y2.update(f1,Real(-1),Real(2));
+    REQUIRE (views_are_equal(y,y2));
+
+    // Same, but accumulating into y
+    evaluate(y, Real(3)*f1, Real(2));
+    y2.update(f1,Real(3),Real(2));
+    REQUIRE (views_are_equal(y,y2));
+  }
+
+  SECTION ("tendency") {
+    // Accumulate a small state increment into a tendency, like
+    // AtmosphereProcess::compute_step_tendencies. The result must be
+    // BFB with the two-step update computation (f_beg=f-f_beg, tend+=f_beg).
+    Field f_beg = f0.clone();
+    Field f     = f0.clone();
+    Field tend  = f1.clone();
+    f_beg.scale(Real(300));
+    f.scale(Real(300));
+    f.update(f1,Real(1e-4),Real(1));
+
+    Field tend2  = tend.clone();
+    Field f_beg2 = f_beg.clone();
+    f_beg2.update(f,1,-1);
+    tend2.update(f_beg2,1,1);
+
+    evaluate(tend, Real(1)*f - Real(1)*f_beg, Real(1));
+    REQUIRE (views_are_equal(tend,tend2));
+  }
+
+  SECTION ("subfields") {
+    Field y  = f0.clone();
+    Field y2 = f0.clone();
+    auto y_1  = y.get_component(1);
+    auto y2_1 = y2.get_component(1);
+    auto f0_1 = f0.get_component(1);
+    auto f1_1 = f1.get_component(1);
+
+    evaluate(y_1, Real(3)*f0_1 + Real(1)*f1_1);
+    y2_1.deep_copy(f0_1);
+    y2_1.update(f1_1,Real(1),Real(3));
+    REQUIRE (views_are_equal(y,y2));
+
+    // Strided rank-1 subfields
+    FieldIdentifier fid2d ("g", {{COL,CMP},{ncol,ncmp}}, kg, "some_grid");
+    Field g (fid2d);
+    g.allocate_view();
+    randomize (g,engine,rpdf);
+    Field z  = g.clone();
+    Field z2 = g.clone();
+    auto g_s  = g.get_component(2);
+    auto z_s  = z.get_component(2);
+    auto z2_s = z2.get_component(2);
+    evaluate(z_s, Real(-1)*g_s, Real(2));
+    z2_s.update(g_s,Real(-1),Real(2));
+    REQUIRE (views_are_equal(z,z2));
+  }
+
+  SECTION ("fill_value") {
+    const Real fill_val = constants::DefaultFillValue<Real>().value;
+    Field x = f0.clone();
+    Field y = f0.clone();
+    x.get_view<Real***,Host>()(1,2,3) = fill_val;
+    x.sync_to_dev();
+
+    evaluate(y, Real(1)*f1 + Real(1)*x);
+    y.sync_to_host();
+    auto yh = y.get_view<Real***,Host>();
+    auto fh = f1.get_view<Real***,Host>();
+    auto xh = x.get_view<Real***,Host>();
+    for (int i=0; i<ncol; ++i) {
+      for (int j=0; j<ncmp; ++j) {
+        for (int k=0; k<nlev; ++k) {
+          if (i==1 && j==2 && k==3) {
+            REQUIRE (yh(i,j,k)==fill_val);
+          } else {
+            REQUIRE (yh(i,j,k)==fh(i,j,k)+xh(i,j,k));
+          }
+        }
+      }
+    }
+  }
+
+  SECTION ("group_scale") {
+    FieldGroupInfo info("G");
+    info.m_bundled = false;
+    FieldGroup g(info);
+    Field y0 = f0.clone();
+    Field y1 = f1.clone();
+    auto y2 = f0.clone().get_component(0);
+    g.m_fields["y0"] = std::make_shared<Field>(y0);
+    g.m_fields["y1"] = std::make_shared<Field>(y1);
+    g.m_fields["y2"] = std::make_shared<Field>(y2);
+
+    scale(g,Real(3));
+
+    Field tmp = f0.clone();
+    tmp.scale(Real(3));
+    REQUIRE (views_are_equal(y0,tmp));
+    tmp.get_component(0).update(y2,Real(1),Real(0));
+    REQUIRE (views_are_equal(y0,tmp));
+    tmp = f1.clone();
+    tmp.scale(Real(3));
+    REQUIRE (views_are_equal(y1,tmp));
+  }
+}
+
 } // anonymous namespace
@@ -147,6 +147,40 @@ TEST_CASE ("get_owners") {
   }
 }
 
+TEST_CASE ("is_unique") {
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int num_local_dofs = 10;
+  const int offset = num_local_dofs*comm.rank();
+  auto grid = std::make_shared<PointGrid>("grid",num_local_dofs,0,comm);
+
+  // Each rank also grabs the first dof of the next rank (with one rank,
+  // that is a local duplicate), so the grid is never unique
+  auto dofs = grid->get_dofs_gids();
+  auto dofs_h = dofs.get_view<gid_type*,Host>();
+  for (int i=0; i<num_local_dofs-1; ++i) {
+    dofs_h[i] = offset + i;
+  }
+  dofs_h[num_local_dofs-1] = ((comm.rank()+1) % comm.size())*num_local_dofs;
+  dofs.sync_to_dev();
+  REQUIRE (not grid->is_unique());
+
+  // Same, but only the last rank grabs a dof of another rank
+  auto grid2 = std::make_shared<PointGrid>("grid2",num_local_dofs,0,comm);
+  auto dofs2 = grid2->get_dofs_gids();
+  auto dofs2_h = dofs2.get_view<gid_type*,Host>();
+  for (int i=0; i<num_local_dofs; ++i) {
+    dofs2_h[i] = offset + i;
+  }
+  if (comm.size()>1 and comm.rank()==comm.size()-1) {
+    dofs2_h[0] = 0;
+  }
+  dofs2.sync_to_dev();
+  REQUIRE (grid2->is_unique()==(comm.size()==1));
+}
+
 TEST_CASE ("gid2lid_map") {
   using gid_type = AbstractGrid::gid_type;
 
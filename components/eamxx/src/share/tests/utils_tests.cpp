@@ -3,6 +3,7 @@
 #include "share/util/scream_array_utils.hpp"
 #include "share/util/scream_universal_constants.hpp"
 #include "share/util/scream_utils.hpp"
+#include "share/util/eamxx_numa_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/scream_config.hpp"
@@ -44,6 +45,36 @@ TEST_CASE("contiguous_superset") {
   REQUIRE ( (superset3==tgt || superset3==tgt_rev) );
 }
 
+TEST_CASE ("first_touch") {
+  using namespace scream;
+  using view_t = KokkosTypes<DefaultDevice>::view_1d<Real>;
+
+  const int size = 1000;
+  for (int nchunks : {1, 3, 7, size, 2*size}) {
+    view_t v (Kokkos::view_alloc("",Kokkos::WithoutInitializing),size);
+    Kokkos::deep_copy(v,1);
+    first_touch_zero(v,nchunks);
+
+    auto vh = cmvdc(v);
+    for (int i=0; i<size; ++i) {
+      REQUIRE (vh(i)==0);
+    }
+  }
+
+  // Placement queries may not be supported, but if they are, all probed
+  // pages of a touched host allocation must be on some node
+  std::vector<Real> data(100000,1);
+  auto placement = get_numa_placement(data.data(),data.size()*sizeof(Real),16);
+  long long nprobed = 0;
+  for (const auto& it : placement) {
+    REQUIRE (it.first>=0);
+    nprobed += it.second;
+  }
+  REQUIRE ((placement.size()==0 or nprobed==16));
+  REQUIRE (numa_placement_string({})=="not available");
+  REQUIRE (numa_placement_string({{0,3},{1,1}})=="node 0: 75.0%, node 1: 25.0%");
+}
+
 TEST_CASE ("time_stamp") {
   using namespace scream;
   using TS = util::TimeStamp;
@@ -0,0 +1,82 @@
+#include "share/util/eamxx_numa_utils.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace scream {
+
+std::map<int,long long>
+get_numa_placement (const void* ptr, const size_t nbytes, const int max_pages)
+{
+  std::map<int,long long> placement;
+#if defined(__linux__) && defined(SYS_move_pages)
+  if (ptr==nullptr or nbytes==0 or max_pages<=0) {
+    return placement;
+  }
+
+  const long page_size = sysconf(_SC_PAGESIZE);
+  const auto first = reinterpret_cast<std::uintptr_t>(ptr) / page_size;
+  const auto last  = (reinterpret_cast<std::uintptr_t>(ptr)+nbytes-1) / page_size;
+  const long long npages = last - first + 1;
+  const long long nprobe = std::min<long long>(npages,max_pages);
+
+  std::vector<void*> pages(nprobe);
+  std::vector<int>   status(nprobe,-1);
+  for (long long i=0; i<nprobe; ++i) {
+    pages[i] = reinterpret_cast<void*>((first + (i*npages)/nprobe)*page_size);
+  }
+
+  // With a null list of target nodes, move_pages does not move anything,
+  // and simply stores in status the node where each page currently resides
+  // (or a negative error code, e.g. -ENOENT for pages not yet touched).
+  const long err = syscall(SYS_move_pages,0,nprobe,pages.data(),nullptr,status.data(),0);
+  if (err<0) {
+    // E.g., a kernel built without NUMA support
+    return placement;
+  }
+  for (const int s : status) {
+    ++placement[s>=0 ? s : -1];
+  }
+#else
+  (void) ptr;
+  (void) nbytes;
+  (void) max_pages;
+#endif
+  return placement;
+}
+
+std::string numa_placement_string (const std::map<int,long long>& placement)
+{
+  if (placement.size()==0) {
+    return "not available";
+  }
+
+  long long total = 0;
+  for (const auto& it : placement) {
+    total += it.second;
+  }
+
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(1);
+  std::string sep = "";
+  for (const auto& it : placement) {
+    ss << sep;
+    if (it.first<0) {
+      ss << "untouched";
+    } else {
+      ss << "node " << it.first;
+    }
+    ss << ": " << 100.0*it.second/total << "%";
+    sep = ", ";
+  }
+  return ss.str();
+}
+
+} // namespace scream
@@ -0,0 +1,61 @@
+#ifndef EAMXX_NUMA_UTILS_HPP
+#define EAMXX_NUMA_UTILS_HPP
+
+#include <ekat/kokkos/ekat_kokkos_types.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+
+namespace scream {
+
+// Zero out a rank-1 view, splitting it in nchunks contiguous chunks processed in parallel.
+// With host-threaded backends (e.g., OpenMP), the OS places each page on the NUMA node of
+// the thread that first writes it. Letting the view constructor zero the memory may end
+// up touching all pages from the master thread, placing the whole allocation on its socket.
+// If the chunks match how compute kernels partition the data (e.g., one chunk per column,
+// with kernels using a league over columns), each page lands near the threads using it.
+// Note: the view should be allocated with Kokkos::WithoutInitializing.
+// On device backends, this is simply a deep_copy.
+template<typename ViewT>
+void first_touch_zero (const ViewT& v, const int nchunks)
+{
+  static_assert (ViewT::rank==1, "Error! first_touch_zero requires a rank-1 view.\n");
+
+  using exec_space = typename ViewT::execution_space;
+  using value_type = typename ViewT::non_const_value_type;
+  constexpr bool host_exec = Kokkos::SpaceAccessibility<exec_space,Kokkos::HostSpace>::accessible;
+
+  if constexpr (not host_exec) {
+    Kokkos::deep_copy(v,value_type(0));
+  } else {
+    const long long size = v.size();
+    if (size==0) {
+      return;
+    }
+    const int n = std::max(1,static_cast<int>(std::min<long long>(nchunks,size)));
+    Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,n),
+                         [=](const int ichunk) {
+      const long long beg = (size*ichunk)/n;
+      const long long end = (size*(ichunk+1))/n;
+      for (long long i=beg; i<end; ++i) {
+        v(i) = value_type(0);
+      }
+    });
+    Kokkos::fence();
+  }
+}
+
+// Count how many memory pages in [ptr,ptr+nbytes) reside on each NUMA node.
+// At most max_pages (evenly spaced) pages are probed. Pages that were never
+// touched (or whose node cannot be determined) are counted under node -1.
+// Returns an empty map if the query is not supported on this platform.
+std::map<int,long long>
+get_numa_placement (const void* ptr, const size_t nbytes, const int max_pages = 1024);
+
+// Format the output of get_numa_placement as "node 0: 75.0%, node 1: 25.0%"
+std::string numa_placement_string (const std::map<int,long long>& placement);
+
+} // namespace scream
+
+#endif // EAMXX_NUMA_UTILS_HPP
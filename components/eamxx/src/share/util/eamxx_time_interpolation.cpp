@@ -1,5 +1,6 @@
 #include "share/util/eamxx_time_interpolation.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/field/field_lincomb.hpp"
 
 namespace scream{
 namespace util {
@@ -70,8 +71,7 @@ void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
     const auto& field0   = m_fm_time0->get_field(name);
     const auto& field1   = m_fm_time1->get_field(name);
           auto field_out = m_interp_fields.at(name);
-    field_out.deep_copy(field0);
-    field_out.update(field1,weight1,weight0);
+    evaluate(field_out, weight0*field0 + weight1*field1);
   }
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -11,6 +11,7 @@
 #include <list>
 #include <algorithm>
 #include <map>
+#include <vector>
 #include <iostream>
 
 namespace scream {
@@ -348,6 +349,47 @@ check_mpi_call (int err, const std::string& context) {
       "  - context: " + context + "\n");
 }
 
+// Send sends[pid] to each rank pid, and return what each rank sent to us (in the
+// entry of the returned vector corresponding to the sender pid). Counts are
+// exchanged with one MPI_Alltoall, and the payloads with one MPI_Alltoallv.
+// For non-builtin T, pass the MPI datatype to use for T.
+template<typename T>
+std::vector<std::vector<T>>
+all_to_all (const std::vector<std::vector<T>>& sends, const ekat::Comm& comm,
+            MPI_Datatype mpi_t = ekat::get_mpi_type<T>())
+{
+  const int nranks = comm.size();
+
+  std::vector<int> send_counts(nranks), recv_counts(nranks);
+  for (int pid=0; pid<nranks; ++pid) {
+    send_counts[pid] = sends[pid].size();
+  }
+  check_mpi_call(MPI_Alltoall(send_counts.data(),1,MPI_INT,
+                              recv_counts.data(),1,MPI_INT,comm.mpi_comm()),
+                 "all_to_all (counts)");
+
+  std::vector<int> send_offsets(nranks+1,0), recv_offsets(nranks+1,0);
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] = send_offsets[pid] + send_counts[pid];
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+
+  std::vector<T> send_buf(send_offsets[nranks]), recv_buf(recv_offsets[nranks]);
+  for (int pid=0; pid<nranks; ++pid) {
+    std::copy(sends[pid].begin(),sends[pid].end(),send_buf.begin()+send_offsets[pid]);
+  }
+  check_mpi_call(MPI_Alltoallv(send_buf.data(),send_counts.data(),send_offsets.data(),mpi_t,
+                               recv_buf.data(),recv_counts.data(),recv_offsets.data(),mpi_t,
+                               comm.mpi_comm()),
+                 "all_to_all (payloads)");
+
+  std::vector<std::vector<T>> recvs(nranks);
+  for (int pid=0; pid<nranks; ++pid) {
+    recvs[pid].assign(recv_buf.begin()+recv_offsets[pid],recv_buf.begin()+recv_offsets[pid+1]);
+  }
+  return recvs;
+}
+
 // Find the full filename list from patterns
 std::vector<std::string> filename_glob(const std::vector<std::string>& patterns);
 
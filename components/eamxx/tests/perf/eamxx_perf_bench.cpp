@@ -0,0 +1,459 @@
+#include "physics/p3/p3_main_wrap.hpp"
+#include "physics/p3/p3_functions_f90.hpp"
+#include "physics/p3/p3_ic_cases.hpp"
+#include "physics/shoc/shoc_main_wrap.hpp"
+#include "physics/shoc/shoc_ic_cases.hpp"
+#include "physics/spa/spa_functions.hpp"
+#ifdef EAMXX_HAS_MAM
+#include "physics/mam/impl/gas_phase_chemistry.hpp"
+#endif
+
+#include "share/scream_types.hpp"
+#include "share/scream_session.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/ekat_pack.hpp"
+#include "ekat/ekat_assert.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/util/ekat_lin_interp.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace scream;
+
+/*
+ * eamxx_perf_bench times standalone kernels on synthetic columns and
+ * reports their throughput in columns per second. Each kernel is set up
+ * once, run once to warm up (first touch, lazy initializations), and then
+ * timed 'repeat' times; the median, min and max throughput are reported.
+ *
+ * With -g, the results are written to a JSON baseline file. Otherwise, the
+ * median throughput of each kernel is compared against the baseline, and
+ * the run fails if any kernel is slower than (1-tol) times its baseline.
+ * Timings are machine specific, so baselines must be generated on the
+ * machine (and with the build configuration) used for the comparison.
+ */
+
+struct BenchParams {
+  Int ncol, nlev, repeat;
+};
+
+struct BenchResult {
+  std::string name;
+  double median, min, max; // columns per second
+};
+
+// Performs one call of the kernel, returning its duration in seconds
+using run_fn = std::function<double()>;
+
+double seconds_since (const std::chrono::steady_clock::time_point& start) {
+  const auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(finish - start).count();
+}
+
+// P3 main on the 'mixed' initial condition of p3_run_and_cmp (one step)
+run_fn setup_p3 (const BenchParams& bp) {
+  using namespace scream::p3;
+  p3_init();
+  return [=] () {
+    const auto d = ic::Factory::create(ic::Factory::mixed, bp.ncol, bp.nlev);
+    d->dt = 300;
+    d->it = 1;
+    d->do_predict_nc = true;
+    d->do_prescribed_CCN = false;
+    return 1e-6*p3_main_wrap(*d);
+  };
+}
+
+// SHOC main on the 'standard' initial condition of shoc_run_and_cmp (one step)
+run_fn setup_shoc (const BenchParams& bp) {
+  using namespace scream::shoc;
+  shoc_init(bp.nlev);
+  return [=] () {
+    const auto d = ic::Factory::create(ic::Factory::standard, bp.ncol, bp.nlev, 3);
+    d->nadv = 1;
+    d->dtime = 300;
+    return 1e-6*shoc_main(*d, false);
+  };
+}
+
+// SPA time and vertical interpolation (spa_main), with the band counts of RRTMGP
+run_fn setup_spa (const BenchParams& bp) {
+  using SPAFunc = spa::SPAFunctions<Real,DefaultDevice>;
+  using Spack = SPAFunc::Spack;
+
+  constexpr int nswbands = 14, nlwbands = 16;
+  const int ncol = bp.ncol, nlev = bp.nlev;
+  const int nlev_src = nlev + 2; // SPA data is padded
+
+  SPAFunc::SPAInput beg(ncol, nlev_src, nswbands, nlwbands);
+  SPAFunc::SPAInput end(ncol, nlev_src, nswbands, nlwbands);
+  SPAFunc::SPAInput tmp(ncol, nlev_src, nswbands, nlwbands);
+  SPAFunc::SPAOutput out(ncol, nlev, nswbands, nlwbands);
+
+  const int npack_src = ekat::npack<Spack>(nlev_src);
+  const int npack_tgt = ekat::npack<Spack>(nlev);
+  SPAFunc::view_2d<Spack> p_src("p_src", ncol, npack_src);
+  SPAFunc::view_2d<Spack> p_tgt("p_tgt", ncol, npack_tgt);
+
+  // Pure sigma source levels, so that p_src = PS*eta, and target levels inside them
+  auto hybm_h  = Kokkos::create_mirror_view(beg.hybm);
+  auto p_tgt_h = Kokkos::create_mirror_view(p_tgt);
+  for (int k = 0; k < npack_src*Spack::n; ++k) {
+    hybm_h(k / Spack::n)[k % Spack::n] = (k + 0.5) / nlev_src;
+  }
+  for (int i = 0; i < ncol; ++i) {
+    for (int k = 0; k < npack_tgt*Spack::n; ++k) {
+      p_tgt_h(i, k / Spack::n)[k % Spack::n] = 1e5*(k + 1) / (nlev + 1);
+    }
+  }
+  Kokkos::deep_copy(beg.hybm, hybm_h);
+  Kokkos::deep_copy(beg.hyam, Spack(0));
+  Kokkos::deep_copy(p_tgt, p_tgt_h);
+  for (auto* in : {&beg, &end}) {
+    Kokkos::deep_copy(in->PS, 1e5);
+    Kokkos::deep_copy(in->data.CCN3, Spack(1));
+    Kokkos::deep_copy(in->data.AER_G_SW, Spack(1));
+    Kokkos::deep_copy(in->data.AER_SSA_SW, Spack(1));
+    Kokkos::deep_copy(in->data.AER_TAU_SW, Spack(1));
+    Kokkos::deep_copy(in->data.AER_TAU_LW, Spack(1));
+  }
+
+  SPAFunc::SPATimeState ts;
+  ts.current_month = 1;
+  ts.t_beg_month = 0;
+  ts.days_this_month = 31;
+  ts.t_now = 15;
+
+  return [=] () {
+    const auto start = std::chrono::steady_clock::now();
+    SPAFunc::spa_main(ts, p_tgt, p_src, beg, end, tmp, out);
+    Kokkos::fence();
+    return seconds_since(start);
+  };
+}
+
+// Column-wise linear interpolation of several fields in pressure, as done
+// by the VerticalRemapper (setup once per step, then one interp per field)
+using LinInterp = ekat::LinInterp<Real,SCREAM_PACK_SIZE>;
+using VIPack = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+using VIKT = KokkosTypes<DefaultDevice>;
+
+// Outside of setup_vinterp, since nvcc does not allow device lambdas inside lambdas
+double run_vinterp (const LinInterp& li,
+                    const VIKT::view_2d<const VIPack>& p_src,
+                    const VIKT::view_1d<const VIPack>& p_tgt,
+                    const VIKT::view_3d<const VIPack>& y_src,
+                    const VIKT::view_3d<VIPack>& y_tgt) {
+  using ESU = ekat::ExeSpaceUtils<VIKT::ExeSpace>;
+
+  const int ncol = y_src.extent_int(1);
+  const int nfields = y_src.extent_int(0);
+  const int npack_tgt = p_tgt.extent_int(0);
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto setup = KOKKOS_LAMBDA (const LinInterp::MemberType& team) {
+    const int icol = team.league_rank();
+    li.setup(team, ekat::subview(p_src, icol), p_tgt);
+  };
+  Kokkos::parallel_for(ESU::get_default_team_policy(ncol, npack_tgt), setup);
+  const auto interp = KOKKOS_LAMBDA (const LinInterp::MemberType& team) {
+    const int icol = team.league_rank() / nfields;
+    const int ifld = team.league_rank() % nfields;
+    li.lin_interp(team, ekat::subview(p_src, icol), p_tgt,
+                  ekat::subview(y_src, ifld, icol), ekat::subview(y_tgt, ifld, icol), icol);
+  };
+  Kokkos::parallel_for(ESU::get_default_team_policy(ncol*nfields, npack_tgt), interp);
+  Kokkos::fence();
+  return seconds_since(start);
+}
+
+run_fn setup_vinterp (const BenchParams& bp) {
+  constexpr int nfields = 10;
+  const int ncol = bp.ncol, nlev_src = bp.nlev, nlev_tgt = bp.nlev;
+  const int npack_src = ekat::npack<VIPack>(nlev_src);
+  const int npack_tgt = ekat::npack<VIPack>(nlev_tgt);
+
+  VIKT::view_2d<VIPack> p_src("p_src", ncol, npack_src);
+  VIKT::view_1d<VIPack> p_tgt("p_tgt", npack_tgt);
+  VIKT::view_3d<VIPack> y_src("y_src", nfields, ncol, npack_src);
+  VIKT::view_3d<VIPack> y_tgt("y_tgt", nfields, ncol, npack_tgt);
+
+  auto p_src_h = Kokkos::create_mirror_view(p_src);
+  auto p_tgt_h = Kokkos::create_mirror_view(p_tgt);
+  for (int i = 0; i < ncol; ++i) {
+    for (int k = 0; k < npack_src*VIPack::n; ++k) {
+      p_src_h(i, k / VIPack::n)[k % VIPack::n] = 1e5*(k + 0.5 + 0.1*(i % 5)) / nlev_src;
+    }
+  }
+  for (int k = 0; k < npack_tgt*VIPack::n; ++k) {
+    p_tgt_h(k / VIPack::n)[k % VIPack::n] = 1e5*(k + 1) / (nlev_tgt + 1);
+  }
+  Kokkos::deep_copy(p_src, p_src_h);
+  Kokkos::deep_copy(p_tgt, p_tgt_h);
+  Kokkos::deep_copy(y_src, VIPack(1));
+
+  const auto li = std::make_shared<LinInterp>(ncol, nlev_src, nlev_tgt);
+
+  return [=] () {
+    return run_vinterp(*li, p_src, p_tgt, y_src, y_tgt);
+  };
+}
+
+#ifdef EAMXX_HAS_MAM
+// MAM4 gas phase chemistry (the implicit solve of MAMMicrophysics), solved on
+// all (column, level) cells at once, on a synthetic atmosphere with uniform VMRs
+run_fn setup_mam_gaschem (const BenchParams& bp) {
+  using namespace mam_coupling;
+  const int ncol = bp.ncol, nlev = bp.nlev;
+
+  DryAtmosphere dry_atm;
+  view_2d T_mid("T_mid", ncol, nlev), p_mid("p_mid", ncol, nlev), p_del("p_del", ncol, nlev);
+  view_2d z_mid("z_mid", ncol, nlev), z_iface("z_iface", ncol, nlev+1);
+  view_1d phis("phis", ncol);
+
+  // Uniform pressure thickness, and a constant lapse rate up to a 200K tropopause
+  auto T_h  = Kokkos::create_mirror_view(T_mid);
+  auto p_h  = Kokkos::create_mirror_view(p_mid);
+  auto zm_h = Kokkos::create_mirror_view(z_mid);
+  auto zi_h = Kokkos::create_mirror_view(z_iface);
+  for (int i = 0; i < ncol; ++i) {
+    for (int k = 0; k < nlev; ++k) {
+      p_h(i, k)  = 1e5*(k + 0.5) / nlev;
+      zm_h(i, k) = 16e3*(nlev - k - 0.5) / nlev;
+      zi_h(i, k) = 16e3*(nlev - k) / nlev;
+      T_h(i, k)  = std::max(200.0, 288.0 - 6.5e-3*zm_h(i, k));
+    }
+    zi_h(i, nlev) = 0;
+  }
+  Kokkos::deep_copy(T_mid, T_h);
+  Kokkos::deep_copy(p_mid, p_h);
+  Kokkos::deep_copy(z_mid, zm_h);
+  Kokkos::deep_copy(z_iface, zi_h);
+  Kokkos::deep_copy(p_del, 1e5 / nlev);
+  dry_atm.T_mid   = T_mid;
+  dry_atm.p_mid   = p_mid;
+  dry_atm.p_del   = p_del;
+  dry_atm.z_mid   = z_mid;
+  dry_atm.z_iface = z_iface;
+  dry_atm.phis    = phis;
+
+  impl::GasPhaseChemistryBatch batch(ncol, nlev);
+  view_2d vmr0("vmr0", batch.vmr.extent(0), batch.vmr.extent(1));
+  Kokkos::deep_copy(vmr0, 1e-9);
+  Kokkos::deep_copy(batch.photo_rates, 1e-5);
+
+  return [=] () {
+    // Each repetition solves the same problem
+    Kokkos::deep_copy(batch.vmr, vmr0);
+    Kokkos::fence();
+    const auto start = std::chrono::steady_clock::now();
+    impl::solve_gas_phase_chemistry(dry_atm, batch, 1800.0);
+    Kokkos::fence();
+    return seconds_since(start);
+  };
+}
+#endif
+
+const std::map<std::string,std::function<run_fn(const BenchParams&)>>& kernels () {
+  static const std::map<std::string,std::function<run_fn(const BenchParams&)>> k = {
+    {"p3",      setup_p3},
+    {"shoc",    setup_shoc},
+    {"spa",     setup_spa},
+#ifdef EAMXX_HAS_MAM
+    {"mam_gaschem", setup_mam_gaschem},
+#endif
+    {"vinterp", setup_vinterp}
+  };
+  return k;
+}
+
+// All available kernels, as a comma-separated list
+std::string all_kernels () {
+  std::string list, sep;
+  for (const auto& it : kernels()) {
+    list += sep + it.first;
+    sep = ",";
+  }
+  return list;
+}
+
+BenchResult bench (const std::string& name, const BenchParams& bp) {
+  const auto run = kernels().at(name)(bp);
+  run(); // warm up
+
+  std::vector<double> cps;
+  for (int r = 0; r < bp.repeat; ++r) {
+    cps.push_back(bp.ncol / std::max(run(), 1e-9));
+  }
+  std::sort(cps.begin(), cps.end());
+
+  BenchResult res;
+  res.name = name;
+  res.min = cps.front();
+  res.max = cps.back();
+  res.median = cps[cps.size()/2];
+  if (cps.size() % 2 == 0) {
+    res.median = 0.5*(res.median + cps[cps.size()/2 - 1]);
+  }
+  return res;
+}
+
+void write_baseline (const std::string& filename, const BenchParams& bp,
+                     const std::vector<BenchResult>& results) {
+  std::ofstream ofs(filename);
+  EKAT_REQUIRE_MSG( ofs.good(), "write_baseline can't write " << filename);
+
+  // Write all reals with an exponent, so that they are parsed back as reals
+  ofs << std::scientific << std::setprecision(6);
+  ofs << "{\n"
+      << "  \"config\": {\"ncol\": " << bp.ncol << ", \"nlev\": " << bp.nlev
+      << ", \"pack_size\": " << SCREAM_PACK_SIZE << ", \"small_pack_size\": " << SCREAM_SMALL_PACK_SIZE
+      << ", \"real_size\": " << sizeof(Real) << "}";
+  for (const auto& r : results) {
+    ofs << ",\n  \"" << r.name << "\": {\"cols_per_sec\": " << r.median
+        << ", \"min\": " << r.min << ", \"max\": " << r.max << "}";
+  }
+  ofs << "\n}\n";
+}
+
+Int compare_baseline (const std::string& filename, const BenchParams& bp, const double tol,
+                      const std::vector<BenchResult>& results) {
+  // JSON is a subset of YAML, so we can use the yaml parser
+  ekat::ParameterList baseline("baseline");
+  ekat::parse_yaml_file(filename, baseline);
+
+  const auto& cfg = baseline.sublist("config");
+  const bool same_cfg = cfg.get<int>("ncol") == bp.ncol &&
+                        cfg.get<int>("nlev") == bp.nlev &&
+                        cfg.get<int>("pack_size") == SCREAM_PACK_SIZE &&
+                        cfg.get<int>("small_pack_size") == SCREAM_SMALL_PACK_SIZE &&
+                        cfg.get<int>("real_size") == static_cast<int>(sizeof(Real));
+  if (not same_cfg) {
+    printf("Baseline %s was generated with a different ncol/nlev/pack size/precision.\n"
+           "Regenerate it with -g.\n", filename.c_str());
+    return 1;
+  }
+
+  Int nerr = 0;
+  for (const auto& r : results) {
+    if (not baseline.isSublist(r.name)) {
+      printf("  %-11s  no baseline entry, skipping\n", r.name.c_str());
+      continue;
+    }
+    const auto ref = baseline.sublist(r.name).get<double>("cols_per_sec");
+    const auto ratio = r.median / ref;
+    const bool slow = ratio < 1 - tol;
+    printf("  %-11s  %1.3e cols/s (baseline %1.3e, ratio %5.3f)%s\n",
+           r.name.c_str(), r.median, ref, ratio, slow ? "  <-- REGRESSION" : "");
+    if (slow) ++nerr;
+  }
+  return nerr;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // namespace anon
+
+int main (int argc, char** argv) {
+  int nerr = 0;
+
+  if (argc == 1) {
+    std::cout <<
+      argv[0] << " [options] -b baseline-filename\n"
+      "Options:\n"
+      "  -g                  Generate baseline file. Default False.\n"
+      "  -t <tol>            Allowed relative throughput loss. Default=0.25.\n"
+      "  -i <cols>           Number of columns. Default=128.\n"
+      "  -k <nlev>           Number of vertical levels. Default=72.\n"
+      "  -r <repeat>         Number of timed repetitions. Default=10.\n"
+      "  -K <kernels>        Comma-separated list of kernels. Default=" << all_kernels() << ".\n";
+    return 1;
+  }
+
+  bool generate = false;
+  double tol = 0.25;
+  BenchParams bp {128, 72, 10};
+  std::string kernel_list = all_kernels();
+  std::string baseline_fn;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-g", "--generate")) generate = true;
+    if (ekat::argv_matches(argv[i], "-t", "--tol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      tol = std::atof(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-b", "--baseline-file")) {
+      expect_another_arg(i, argc);
+      ++i;
+      baseline_fn = argv[i];
+    }
+    if (ekat::argv_matches(argv[i], "-i", "--ncol")) {
+      expect_another_arg(i, argc);
+      ++i;
+      bp.ncol = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-k", "--nlev")) {
+      expect_another_arg(i, argc);
+      ++i;
+      bp.nlev = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-r", "--repeat")) {
+      expect_another_arg(i, argc);
+      ++i;
+      bp.repeat = std::atoi(argv[i]);
+    }
+    if (ekat::argv_matches(argv[i], "-K", "--kernels")) {
+      expect_another_arg(i, argc);
+      ++i;
+      kernel_list = argv[i];
+    }
+  }
+  EKAT_REQUIRE_MSG(bp.repeat > 0, "Error! Number of repetitions must be positive.\n");
+  EKAT_REQUIRE_MSG(baseline_fn != "", "Error! No baseline file specified.\n");
+
+  std::vector<std::string> names;
+  std::stringstream ss(kernel_list);
+  for (std::string name; std::getline(ss, name, ',');) {
+    EKAT_REQUIRE_MSG(kernels().count(name) == 1, "Error! Unknown kernel '" << name << "'.\n");
+    names.push_back(name);
+  }
+
+  scream::initialize_scream_session(argc, argv); {
+    printf("Benchmarking with ncol=%d, nlev=%d, packn=%d, small_packn=%d, repeat=%d\n",
+           bp.ncol, bp.nlev, SCREAM_PACK_SIZE, SCREAM_SMALL_PACK_SIZE, bp.repeat);
+
+    std::vector<BenchResult> results;
+    for (const auto& name : names) {
+      results.push_back(bench(name, bp));
+      const auto& r = results.back();
+      printf("  %-11s  median %1.3e cols/s, min %1.3e, max %1.3e\n",
+             r.name.c_str(), r.median, r.min, r.max);
+    }
+
+    if (generate) {
+      std::cout << "Generating to " << baseline_fn << "\n";
+      write_baseline(baseline_fn, bp, results);
+    } else {
+      printf("Comparing with %s at tol %1.2f\n", baseline_fn.c_str(), tol);
+      nerr += compare_baseline(baseline_fn, bp, tol, results);
+    }
+    scream::p3::P3GlobalForFortran::deinit();
+  } scream::finalize_scream_session();
+
+  return nerr != 0 ? 1 : 0;
+}
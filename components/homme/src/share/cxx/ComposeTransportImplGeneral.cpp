@@ -143,7 +143,11 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     be->set_diagnostics_level(sp.internal_diagnostics_level);
     be->set_buffers_manager(bm_exchange);
     be->set_num_fields(0, 0, m_data.qsize + 1);
+#ifdef HOMMEXX_MIXED_PRECISION_TRACERS
+    be->set_single_precision(true);
+#endif
     be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
+    be->set_single_precision(false);
     be->register_field(m_derived.m_omega_p);
     be->registration_completed();
   }
@@ -171,8 +175,12 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       be->set_num_fields(0, 0, m_data.hv_q);
       if (i == 0) 
         be->register_field(m_tracers.qtens_biharmonic, m_data.hv_q, 0);
-      else
+      else {
+#ifdef HOMMEXX_MIXED_PRECISION_TRACERS
+        be->set_single_precision(true);
+#endif
         be->register_field(m_tracers.Q, m_data.hv_q, 0);
+      }
       be->registration_completed();
     }
   }
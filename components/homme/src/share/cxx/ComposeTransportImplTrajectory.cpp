@@ -395,23 +395,12 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
       Kokkos::parallel_for(m_tp_ne, calc_dprecon);
       Kokkos::fence();
       remap_v(m_dp3d, np1, m_divdp, m_vn0);
-      const auto sphere = KOKKOS_LAMBDA (const MT& team) {
-        KernelVariables kv(team, tu_ne);
-        const auto ie = kv.ie;
-        const auto spheremp = Homme::subview(m_spheremp, ie);
-        const auto rspheremp = Homme::subview(m_rspheremp, ie);
-        const auto f = [&] (const int i, const int j, const int kp) {
-          const auto dprecon = Homme::subview(m_divdp, ie);
-          dprecon(i,j,kp) = dprecon(i,j,kp)*spheremp(i,j)*rspheremp(i,j);
-        };
-        cti::loop_ijk<num_lev_pack>(kv, f);
-      };
-      Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne, sphere);
       Kokkos::fence();
       GPTLstop("compose_3d_levels");
     }
     GPTLstart("compose_v_bexchv");
+    // The DSS weighting of dprecon, which is exchanged together with vstar, is
+    // fused into this kernel rather than done in a separate pass.
     const auto calc_midpoint_velocity = KOKKOS_LAMBDA (const MT& team) {
       KernelVariables kv(team, tu_ne);
       const auto ie = kv.ie;
@@ -426,21 +415,23 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
                     SNlev(Homme::subview(buf1a, kv.team_idx).data()),
                     S2Nlev(Homme::subview(buf2a, kv.team_idx).data()),
                     ugradv);
+      const auto dprecon = Homme::subview(m_divdp, ie);
       // Write the midpoint velocity to vstar.
       const auto f = [&] (const int i, const int j, const int k) {
         for (int d = 0; d < 2; ++d)
           vstar(d,i,j,k) = (((vn0(d,i,j,k) + vstar(d,i,j,k))/2 - dt*ugradv(d,i,j,k)/2)*
                             spheremp(i,j)*rspheremp(i,j));
+        if (independent_time_steps)
+          dprecon(i,j,k) = dprecon(i,j,k)*spheremp(i,j)*rspheremp(i,j);
       };
       cti::loop_ijk<num_lev_pack>(kv, f);
     };
     Kokkos::parallel_for(m_tp_ne, calc_midpoint_velocity);
   }
-  { // DSS velocity.
+  { // DSS velocity (and dprecon, in the same message, if independent_time_steps).
     Kokkos::fence();
     const auto be = m_v_dss_be[m_data.independent_time_steps ? 1 : 0];
     be->exchange();
-    Kokkos::fence();
   }
   GPTLstop("compose_v_bexchv");
   { // Calculate departure point.
@@ -237,7 +237,11 @@ public:
         int num_mid = dssi==DSSOption::ETA ? 0 : 1;
         int num_int = 1 - num_mid;
         be.set_num_fields(0, 0, m_data.qsize+num_mid,num_int);
+#ifdef HOMMEXX_MIXED_PRECISION_TRACERS
+        be.set_single_precision(true);
+#endif
         be.register_field(m_tracers.qdp, np1_qdp, m_data.qsize, 0);
+        be.set_single_precision(false);
         switch(dssi) {
           case DSSOption::ETA:
             be.register_field(m_derived_state.m_eta_dot_dpdn);
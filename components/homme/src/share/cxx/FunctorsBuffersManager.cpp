@@ -6,6 +6,7 @@
 
 #include "FunctorsBuffersManager.hpp"
 #include "ErrorDefs.hpp"
+#include "utilities/ViewUtils.hpp"
 #ifdef HOMMEXX_BFB_TESTING
 #include "utilities/TestUtils.hpp"
 #include <random>
@@ -26,7 +27,10 @@ void FunctorsBuffersManager::request_size (const int num_doubles) {
 void FunctorsBuffersManager:: allocate () {
   Errors::runtime_check(!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
-  m_buffer = ExecViewManaged<Real*>("",m_size);
+  // Functors carve per-team slots out of the buffer, so let each thread
+  // first-touch its share of it, rather than zeroing it from the master thread
+  m_buffer = ExecViewManaged<Real*>(Kokkos::view_alloc("",Kokkos::WithoutInitializing),m_size);
+  first_touch_zero(m_buffer,ExecSpace().concurrency());
 
   generate_random_data();
 
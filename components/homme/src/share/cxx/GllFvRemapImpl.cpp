@@ -610,6 +610,30 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   ElementOps ops; ops.init(hvcoord);
   const auto tu_ne = m_tu_ne;
 
+  // ps and dp_fv. The tracer kernel needs only dp_fv, so compute it first and
+  // leave the (u,v) and T remaps for after the extrema exchange is posted.
+  const auto fdp = KOKKOS_LAMBDA (const MT& team) {
+    KernelVariables kv(team, tu_ne);
+    const auto ie = kv.ie;
+
+    const auto all = Kokkos::ALL();
+    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const EVU<Real*> rw1s(pack2real(rw1), nreal_per_slot1);
+
+    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
+      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
+
+    const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
+    const evur2 ps_v_ie(&ps_v(ie,timeidx,0,0), np2, 1), w1(rw1s.data(), np2, 1);
+    Real* const w2 = rw1s.data() + np2;
+    remapd(team, nf2, np2, 1, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+           ps_v_ie, w1, evur2(w2, nf2, 1));
+    kv.team_barrier();
+    calc_dp_fv(team, hvcoord, nf2, nlevpk, EVU<Real*>(w2, nf2), dp_fv_ie);
+  };
+  Kokkos::fence();
+  parallel_for(m_tp_ne, fdp);
+
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
     const auto ie = kv.ie;
@@ -621,21 +645,10 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
     const auto r2w = Kokkos::subview(buf20, kv.team_idx, all, all, all, all);
-    const EVU<Real*> rw1s(pack2real(rw1), nreal_per_slot1);
-    
+
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-
-    // ps and dp_fv
-    const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk); {
-      const evur2 ps_v_ie(&ps_v(ie,timeidx,0,0), np2, 1), w1(rw1s.data(), np2, 1);
-      Real* const w2 = rw1s.data() + np2;
-      remapd(team, nf2, np2, 1, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-             ps_v_ie, w1, evur2(w2, nf2, 1));
-      kv.team_barrier();
-      calc_dp_fv(team, hvcoord, nf2, nlevpk, EVU<Real*>(w2, nf2), dp_fv_ie);
-      kv.team_barrier();
-    }
+    const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
 
     { // (u,v)
       EVU<Scalar[3][NP*NP][NUM_LEV]> fm_ie(&fm(ie,0,0,0,0));
@@ -696,8 +709,6 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       parallel_for(ttrg, f2);
     }
   };
-  Kokkos::fence();
-  parallel_for(m_tp_ne, fe);
 
   const auto dp_g = m_state.m_dp3d;
   const auto q_g = m_tracers.Q;
@@ -755,8 +766,11 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   Kokkos::fence();
   parallel_for(m_tp_ne_qsize, feq);
 
-  // Halo exchange extrema data.
-  m_extrema_be->exchange_min_max();
+  // Halo exchange extrema data. The (u,v) and T remaps don't depend on the
+  // limiter bounds, so run them while the extrema messages are in flight.
+  m_extrema_be->pack_and_send_min_max();
+  parallel_for(m_tp_ne, fe);
+  m_extrema_be->recv_and_unpack_min_max();
 
   const auto geq = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, qsize, tu_ne_qsize);
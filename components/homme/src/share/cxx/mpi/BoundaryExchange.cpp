@@ -12,6 +12,8 @@
 
 #include "utilities/VectorUtils.hpp"
 
+#include <algorithm>
+
 #ifndef HOMME_BE_NO_HASHER
 // It's convenient and clean to use boundary exchanges as the place to hash
 // state. However, this interferes with the BoundaryExchange unit test's
@@ -36,6 +38,14 @@ static void alloc3d (A& a, B& b, int ne, int a2, int b2) {
   b = ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_P]>**>("3d interface fields", ne, b2);
 }
 
+// Number of Reals taken by one 3d field on a connection with npts points.
+// Single precision fields store two values per Real (rounding up, so that
+// the following buffers stay aligned to a Real).
+static int buf_size_3d (const int npts, const int nlev, const bool single_precision) {
+  const int size = npts*nlev*VECTOR_SIZE;
+  return single_precision ? (size+1)/2 : size;
+}
+
 BoundaryExchange::BoundaryExchange()
 {
   m_num_1d_fields = 0;
@@ -61,6 +71,8 @@ BoundaryExchange::BoundaryExchange()
   m_recv_pending = false;
 
   m_diagnostics_level = 0;
+
+  m_register_single_precision = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -138,6 +150,14 @@ void BoundaryExchange::set_buffers_manager (std::shared_ptr<MpiBuffersManager> b
   m_buffers_manager->add_customer(this);
 }
 
+void BoundaryExchange::set_single_precision (const bool single_precision)
+{
+  // Only 3d midpoint fields registered from now on are affected
+  assert (m_registration_started && !m_registration_completed);
+
+  m_register_single_precision = single_precision;
+}
+
 void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_int_fields)
 {
   // We don't allow to call this method twice in a row. If you want to change the number of fields,
@@ -196,6 +216,12 @@ void BoundaryExchange::clean_up()
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
 
+  m_3d_nlev_pack.clear();
+  m_3d_nlev_pack_d = decltype(m_3d_nlev_pack_d)();
+  m_3d_single_prec.clear();
+  m_3d_single_prec_d = decltype(m_3d_single_prec_d)();
+  m_register_single_precision = false;
+
   // If we clean up, we need to reset the number of fields
   m_registration_started   = false;
   m_registration_completed = false;
@@ -227,18 +253,25 @@ void BoundaryExchange::registration_completed()
   // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
   //       we have 2 Real per level (max and min over element).
 
-  int single_ptr_buf_size = m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
-  for (int i = 0; i < m_num_3d_fields; ++i)
-    single_ptr_buf_size += m_3d_nlev_pack[i]*VECTOR_SIZE;
-  m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
-  m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
+  // Note: single precision 3d fields use half the Reals (see buf_size_3d).
+  const bool any_single_prec =
+    std::find(m_3d_single_prec.begin(), m_3d_single_prec.end(), 1) != m_3d_single_prec.end();
+  for (const auto kind : {ConnectionKind::CORNER, ConnectionKind::EDGE}) {
+    const int npts = kind==ConnectionKind::CORNER ? 1 : NP;
+    int elem_buf_size = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE
+                      + (m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE)*npts;
+    for (int i = 0; i < m_num_3d_fields; ++i)
+      elem_buf_size += buf_size_3d(npts, m_3d_nlev_pack[i], m_3d_single_prec[i]);
+    m_elem_buf_size[etoi(kind)] = elem_buf_size;
+  }
 
   // Determine what kind of BE is this (exchange or exchange_min_max)
   m_exchange_type = m_num_1d_fields>0 ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
 
   // Finalize bookkeeping for any exchange on fewer than NUM_LEV levels.
+  // The single precision pack/unpack always reads the number of levels per field.
   {
-    bool need_nlev_pack = false;
+    bool need_nlev_pack = any_single_prec;
     for (int i = 0; i < m_num_3d_fields; ++i)
       if (m_3d_nlev_pack[i] != NUM_LEV) {
         Errors::runtime_check(m_3d_nlev_pack[i] < NUM_LEV,
@@ -257,6 +290,14 @@ void BoundaryExchange::registration_completed()
     // Clear the host vector if it's not needed.
     if ( ! need_nlev_pack) m_3d_nlev_pack = decltype(m_3d_nlev_pack)();
   }
+  if (any_single_prec) {
+    m_3d_single_prec_d = ExecViewManaged<int*>("m_3d_single_prec_d", m_num_3d_fields);
+    const auto h = Kokkos::create_mirror_view(m_3d_single_prec_d);
+    for (int i = 0; i < m_num_3d_fields; ++i) h(i) = m_3d_single_prec[i];
+    Kokkos::deep_copy(m_3d_single_prec_d, h);
+  } else {
+    m_3d_single_prec = decltype(m_3d_single_prec)();
+  }
 
   // Prohibit further registration of fields, and allow exchange
   m_registration_started   = false;
@@ -461,6 +502,47 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
   }
 }
 
+// Pack 3d fields when some of them are exchanged in single precision. The
+// number of levels is always read from nlev_packs.
+static void
+pack_mixed_precision (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+                      const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**> fields_3d,
+                      const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
+                      const ExecViewUnmanaged<ExecViewUnmanaged<float**>**> send_3d_sp_buffers,
+                      const ExecViewUnmanaged<const int*> nlev_packs,
+                      const ExecViewUnmanaged<const int*> single_prec,
+                      const int num_3d_fields) {
+  const ConnectionHelpers helpers;
+  const int nconn = ucon.extent_int(0);
+  Kokkos::parallel_for(
+    Kokkos::RangePolicy<ExecSpace>(0, num_3d_fields*nconn*NUM_LEV),
+    KOKKOS_LAMBDA(const int it) {
+      const int ilev = it % NUM_LEV;
+      const int ifield = (it / NUM_LEV) % num_3d_fields;
+      if (ilev >= nlev_packs(ifield))
+        return;
+      const int iconn = it / (num_3d_fields*NUM_LEV);
+      const auto& info = ucon(iconn);
+      const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
+                                info.sharing_local_remote_iconn :
+                                iconn);
+      const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
+      const auto& f3 = fields_3d(info.local_lid, ifield);
+      if (single_prec(ifield)) {
+        const auto& sb = send_3d_sp_buffers(ifield, buffer_iconn);
+        for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k) {
+          const auto& f = f3(pts[k].ip, pts[k].jp, ilev);
+          for (int v = 0; v < VECTOR_SIZE; ++v)
+            sb(k, ilev*VECTOR_SIZE + v) = static_cast<float>(f[v]);
+        }
+      } else {
+        const auto& sb = send_3d_buffers(ifield, buffer_iconn);
+        for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
+          sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+      }
+    });
+}
+
 void BoundaryExchange::pack_and_send ()
 {
   tstart("be pack_and_send");
@@ -498,7 +580,10 @@ void BoundaryExchange::pack_and_send ()
          m_num_2d_fields);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
+    if (m_3d_single_prec_d.size() > 0)
+      pack_mixed_precision(ucon, m_3d_fields, m_send_3d_buffers, m_send_3d_sp_buffers,
+                           m_3d_nlev_pack_d, m_3d_single_prec_d, m_num_3d_fields);
+    else if (m_3d_nlev_pack_d.size() > 0)
       pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
                           m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
@@ -676,6 +761,159 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   }
 }
 
+// Unpack 3d fields when some of them are exchanged in single precision.
+// Before accumulating the neighbors' contributions, the local values on the
+// element boundary of single precision fields are rounded the same way as
+// the ones that were sent, so that all copies of a shared point end up with
+// the same sum of contributions.
+// assume:conn-edges-snwe
+static void
+unpack_mixed_precision (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+                        const ExecViewUnmanaged<const int*> ucon_ptr,
+                        const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**> fields_3d,
+                        const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> recv_3d_buffers,
+                        const ExecViewUnmanaged<ExecViewUnmanaged<float**>**> recv_3d_sp_buffers,
+                        const ExecViewUnmanaged<const int*> nlev_packs,
+                        const ExecViewUnmanaged<const int*> single_prec,
+                        const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
+                        const int num_elems, const int num_3d_fields) {
+  if (OnGpu<ExecSpace>::value) {
+    const ConnectionHelpers helpers;
+    Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_3d_fields*NUM_LEV),
+      KOKKOS_LAMBDA(const int it) {
+        const int ifield = (it / NUM_LEV) % num_3d_fields;
+        const int ilev = it % NUM_LEV;
+        if (ilev >= nlev_packs(ifield))
+          return;
+        const int ie = it / (num_3d_fields*NUM_LEV);
+        const auto iconn_beg = ucon_ptr(ie);
+        const auto iconn_end = ucon_ptr(ie+1);
+        const auto& f3 = fields_3d(ie, ifield);
+        if (single_prec(ifield)) {
+          for (int k = 0; k < NP; ++k) {
+            for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
+              const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
+              auto& f = f3(pts.ip, pts.jp, ilev);
+              for (int v = 0; v < VECTOR_SIZE; ++v)
+                f[v] = static_cast<float>(f[v]);
+            }
+          }
+          for (int k = 0; k < NP; ++k) {
+            for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
+              const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
+              const auto& r3 = recv_3d_sp_buffers(ifield, iconn_beg + iedge);
+              auto& f = f3(pts.ip, pts.jp, ilev);
+              for (int v = 0; v < VECTOR_SIZE; ++v)
+                f[v] += r3(k, ilev*VECTOR_SIZE + v);
+            }
+          }
+          for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
+            const auto& pts = helpers.CONNECTION_PTS_FWD[ucon(iconn).local_dir][0];
+            const auto& r3 = recv_3d_sp_buffers(ifield, iconn);
+            auto& f = f3(pts.ip, pts.jp, ilev);
+            for (int v = 0; v < VECTOR_SIZE; ++v)
+              f[v] += r3(0, ilev*VECTOR_SIZE + v);
+          }
+        } else {
+          for (int k = 0; k < NP; ++k) {
+            for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
+              const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
+              f3(pts.ip, pts.jp, ilev) +=
+                recv_3d_buffers(ifield, iconn_beg + iedge)(k, ilev);
+            }
+          }
+          for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
+            const auto& pts = helpers.CONNECTION_PTS_FWD[ucon(iconn).local_dir][0];
+            f3(pts.ip, pts.jp, ilev) +=
+              recv_3d_buffers(ifield, iconn)(0, ilev);
+          }
+        }
+      });
+    if (rspheremp) {
+      Kokkos::fence();
+      const auto rsmp = *rspheremp;
+      Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_3d_fields*NP*NP*NUM_LEV),
+        KOKKOS_LAMBDA(const int it) {
+          const int ie = it / (num_3d_fields*NUM_LEV*NP*NP);
+          const int ifield = (it / (NP*NP*NUM_LEV)) % num_3d_fields;
+          const int i = (it / (NP*NUM_LEV)) % NP;
+          const int j = (it / NUM_LEV) % NP;
+          const int ilev = it % NUM_LEV;
+          if (ilev >= nlev_packs(ifield))
+            return;
+          fields_3d(ie, ifield)(i, j, ilev) *= rsmp(ie, i, j);
+        });
+    }
+  } else {
+    HOMMEXX_STATIC const ConnectionHelpers helpers;
+    const auto num_parallel_iterations = num_elems*num_3d_fields;
+    Kokkos::parallel_for(
+      Kokkos::TeamPolicy<ExecSpace>(num_parallel_iterations, 1, NUM_LEV),
+      KOKKOS_LAMBDA(const TeamMember& team) {
+        Homme::KernelVariables kv(team, num_3d_fields);
+        const int ie = kv.ie;
+        const int ifield = kv.iq;
+        const bool sp = single_prec(ifield);
+        const auto tvr = Kokkos::ThreadVectorRange(kv.team, nlev_packs(ifield));
+        const auto& f3 = fields_3d(ie, ifield);
+        const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
+        const auto rf = [&] (const int& ip, const int& jp) {
+          auto* const f3p = &f3(ip, jp, 0);
+          Kokkos::parallel_for(tvr, [&] (const int& ilev) {
+            for (int v = 0; v < VECTOR_SIZE; ++v)
+              f3p[ilev][v] = static_cast<float>(f3p[ilev][v]);
+          });
+        };
+        const auto af = [&] (const int& iconn, const int& k, const int& ip, const int& jp) {
+          auto* const f3p = &f3(ip, jp, 0);
+          if (sp) {
+            const auto& r3 = recv_3d_sp_buffers(ifield, iconn);
+            assert(r3.size() > 0);
+            const auto* const r3p = &r3(k, 0);
+            Kokkos::parallel_for(tvr, [&] (const int& ilev) {
+              for (int v = 0; v < VECTOR_SIZE; ++v)
+                f3p[ilev][v] += r3p[ilev*VECTOR_SIZE + v];
+            });
+          } else {
+            const auto& r3 = recv_3d_buffers(ifield, iconn);
+            assert(r3.size() > 0);
+            const auto* const r3p = &r3(k, 0);
+            Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          }
+        };
+        if (sp) {
+          for (int k = 0; k < NP; ++k) {
+            rf(0,    k   );
+            rf(NP-1, k   );
+            rf(k,    0   );
+            rf(k,    NP-1);
+          }
+        }
+        for (int k = 0; k < NP; ++k) {
+          af(iconn_beg + 0, k, 0,    k   );
+          af(iconn_beg + 1, k, NP-1, k   );
+          af(iconn_beg + 2, k, k,    0   );
+          af(iconn_beg + 3, k, k,    NP-1);
+        }
+        for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
+          const auto dir = ucon(iconn).local_dir;
+          af(iconn, 0, helpers.CONNECTION_PTS_FWD[dir][0].ip,
+                       helpers.CONNECTION_PTS_FWD[dir][0].jp);
+        }
+        if (rspheremp) {
+          for (int i = 0; i < NP; ++i)
+            for (int j = 0; j < NP; ++j) {
+              auto* const f3p = &f3(i, j, 0);
+              const auto& rsmp = (*rspheremp)(ie, i, j);
+              Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] *= rsmp; });
+            }
+        }
+      });
+  }
+}
+
 void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
 {
   tstart("be recv_and_unpack");
@@ -730,7 +968,11 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
            m_num_2d_fields);
   // ...then unpack 3d fields (if any)...
   if (m_num_3d_fields>0) {
-    if (m_3d_nlev_pack_d.size() > 0)
+    if (m_3d_single_prec_d.size() > 0)
+      unpack_mixed_precision(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, m_recv_3d_sp_buffers,
+                             m_3d_nlev_pack_d, m_3d_single_prec_d, rspheremp,
+                             m_num_elems, m_num_3d_fields);
+    else if (m_3d_nlev_pack_d.size() > 0)
       unpack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
                             m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
@@ -1061,6 +1303,9 @@ void BoundaryExchange::build_buffer_views_and_requests()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("3d recv buffer", m_num_3d_fields, nconn);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("3d interface send buffer", m_num_3d_int_fields, nconn);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("3d interface recv buffer", m_num_3d_int_fields, nconn);
+  const int num_3d_sp_fields = m_3d_single_prec.empty() ? 0 : m_num_3d_fields;
+  m_send_3d_sp_buffers = decltype(m_send_3d_sp_buffers)("3d single precision send buffer", num_3d_sp_fields, nconn);
+  m_recv_3d_sp_buffers = decltype(m_recv_3d_sp_buffers)("3d single precision recv buffer", num_3d_sp_fields, nconn);
   const auto h_send_1d_buffers = Kokkos::create_mirror_view(m_send_1d_buffers);
   const auto h_recv_1d_buffers = Kokkos::create_mirror_view(m_recv_1d_buffers);
   const auto h_send_2d_buffers = Kokkos::create_mirror_view(m_send_2d_buffers);
@@ -1069,6 +1314,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   const auto h_recv_3d_buffers = Kokkos::create_mirror_view(m_recv_3d_buffers);
   const auto h_send_3d_int_buffers = Kokkos::create_mirror_view(m_send_3d_int_buffers);
   const auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
+  const auto h_send_3d_sp_buffers = Kokkos::create_mirror_view(m_send_3d_sp_buffers);
+  const auto h_recv_3d_sp_buffers = Kokkos::create_mirror_view(m_recv_3d_sp_buffers);
 
   ConnectionHelpers helpers;
   for (size_t k = 0; k < nconn; ++k) {
@@ -1095,13 +1342,23 @@ void BoundaryExchange::build_buffer_views_and_requests()
     }
     for (int f = 0; f < m_num_3d_fields; ++f) {
       const auto nlev_3d = m_3d_nlev_pack.empty() ? NUM_LEV : m_3d_nlev_pack[f];
-      h_send_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
-        helpers.CONNECTION_SIZE[info.kind], nlev_3d);
-      h_recv_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
-        reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
-        helpers.CONNECTION_SIZE[info.kind], nlev_3d);
-      h_buf_offset[info.sharing] += h_increment_3d[info.kind]*nlev_3d*VECTOR_SIZE;
+      const bool single_prec = !m_3d_single_prec.empty() && m_3d_single_prec[f];
+      if (single_prec) {
+        h_send_3d_sp_buffers(f, i) = ExecViewUnmanaged<float**>(
+          reinterpret_cast<float*>(send_buffer.get() + h_buf_offset[info.sharing]),
+          helpers.CONNECTION_SIZE[info.kind], nlev_3d*VECTOR_SIZE);
+        h_recv_3d_sp_buffers(f, i) = ExecViewUnmanaged<float**>(
+          reinterpret_cast<float*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+          helpers.CONNECTION_SIZE[info.kind], nlev_3d*VECTOR_SIZE);
+      } else {
+        h_send_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
+          reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
+          helpers.CONNECTION_SIZE[info.kind], nlev_3d);
+        h_recv_3d_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
+          reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+          helpers.CONNECTION_SIZE[info.kind], nlev_3d);
+      }
+      h_buf_offset[info.sharing] += buf_size_3d(h_increment_3d[info.kind], nlev_3d, single_prec);
     }
     for (int f = 0; f < m_num_3d_int_fields; ++f) {
       h_send_3d_int_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
@@ -1121,6 +1378,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   Kokkos::deep_copy(m_recv_3d_buffers, h_recv_3d_buffers);
   Kokkos::deep_copy(m_send_3d_int_buffers, h_send_3d_int_buffers);
   Kokkos::deep_copy(m_recv_3d_int_buffers, h_recv_3d_int_buffers);
+  Kokkos::deep_copy(m_send_3d_sp_buffers, h_send_3d_sp_buffers);
+  Kokkos::deep_copy(m_recv_3d_sp_buffers, h_recv_3d_sp_buffers);
 
 #ifndef NDEBUG
   // Sanity check: compute the buffers sizes for this boundary exchange, and
@@ -1275,6 +1534,8 @@ void BoundaryExchange::clear_buffer_views_and_requests ()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("m_recv_3d_buffers", 0, 0);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("m_send_3d_int_buffers", 0, 0);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("m_recv_3d_int_buffers", 0, 0);
+  m_send_3d_sp_buffers = decltype(m_send_3d_sp_buffers)("m_send_3d_sp_buffers", 0, 0);
+  m_recv_3d_sp_buffers = decltype(m_recv_3d_sp_buffers)("m_recv_3d_sp_buffers", 0, 0);
 
   // Done
   m_buffer_views_and_requests_built = false;
@@ -181,6 +181,12 @@ public:
                                >::type field,
         int num_dims, int start_dim, int nlev);
 
+  // 3d midpoint fields registered after set_single_precision(true) (and until it is
+  // called again with false) are packed in single precision in the send/recv buffers.
+  // This halves their message volume, at the price of rounding their values on the
+  // element boundaries to single precision. Fields are still stored in double precision.
+  void set_single_precision (const bool single_precision);
+
   // This registration method should be used for the exchange of min/max fields
   template<int DIM, typename... Properties>
   void register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
@@ -287,6 +293,14 @@ private:
   std::vector<int> m_3d_nlev_pack;        // during registration
   ExecViewManaged<int*> m_3d_nlev_pack_d; //  after registration
 
+  // Single precision packing of 3d fields (see set_single_precision). The float buffers
+  // are set only for the fields flagged in m_3d_single_prec, and are empty if no field is.
+  bool m_register_single_precision;
+  std::vector<int> m_3d_single_prec;        // during registration
+  ExecViewManaged<int*> m_3d_single_prec_d; //  after registration
+  ExecViewManaged<ExecViewUnmanaged<float**>**>  m_send_3d_sp_buffers;
+  ExecViewManaged<ExecViewUnmanaged<float**>**>  m_recv_3d_sp_buffers;
+
   // The number of registered fields
   int         m_num_1d_fields;    // Without counting the 2x factor due to min/max fields
   int         m_num_2d_fields;
@@ -440,6 +454,7 @@ void BoundaryExchange::register_field (ExecView<Scalar*[OUTER_DIM][DIM][NP][NP][
   }
 
   for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  m_3d_single_prec.resize(m_3d_nlev_pack.size(), m_register_single_precision);
   m_num_3d_fields += num_dims;
 }
 
@@ -465,6 +480,7 @@ void BoundaryExchange::register_field (ExecView<Scalar***[NP][NP][NUM_LEV], Prop
   }
 
   for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  m_3d_single_prec.resize(m_3d_nlev_pack.size(), m_register_single_precision);
   m_num_3d_fields += num_dims;
 }
 
@@ -492,6 +508,7 @@ void BoundaryExchange::register_field_impl (
   }
 
   m_3d_nlev_pack.push_back(nlev);
+  m_3d_single_prec.push_back(m_register_single_precision);
   ++m_num_3d_fields;
 }
 
@@ -569,6 +586,7 @@ void BoundaryExchange::register_field_impl (
   }
 
   for (int i = 0; i < num_dims; ++i) m_3d_nlev_pack.push_back(nlev);
+  m_3d_single_prec.resize(m_3d_nlev_pack.size(), m_register_single_precision);
   m_num_3d_fields += num_dims;
 }
 
@@ -8,6 +8,7 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "utilities/ViewUtils.hpp"
 
 namespace Homme
 {
@@ -76,9 +77,15 @@ void MpiBuffersManager::allocate_buffers ()
   }
 
   // The buffers used for packing/unpacking
-  m_send_buffer  = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
-  m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
-  m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
+  // The pack/unpack kernels spread the elements across all threads, so split
+  // the first touch of the buffers the same way (see first_touch_zero)
+  m_send_buffer  = ExecViewManaged<Real*>(Kokkos::view_alloc("send buffer", Kokkos::WithoutInitializing), m_mpi_buffer_size);
+  m_recv_buffer  = ExecViewManaged<Real*>(Kokkos::view_alloc("recv buffer", Kokkos::WithoutInitializing), m_mpi_buffer_size);
+  m_local_buffer = ExecViewManaged<Real*>(Kokkos::view_alloc("local buffer",Kokkos::WithoutInitializing), m_local_buffer_size);
+  const int nchunks = ExecSpace().concurrency();
+  first_touch_zero(m_send_buffer, nchunks);
+  first_touch_zero(m_recv_buffer, nchunks);
+  first_touch_zero(m_local_buffer,nchunks);
 
   // The buffers used in MPI calls
   m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
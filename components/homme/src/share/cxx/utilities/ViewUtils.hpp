@@ -122,6 +122,41 @@ void print_col (const char* prefix, const ExecViewUnmanaged<const Real[NUM_LEVEL
   printf("\n");
 }
 
+// ================ Zero a view with NUMA-friendly first touch ======================= //
+// Zero out a rank-1 view, splitting it in nchunks contiguous chunks processed in parallel.
+// On host-threaded builds, a page is placed on the NUMA node of the thread that first
+// writes it, so the view should be allocated with Kokkos::WithoutInitializing, and
+// nchunks should match how the kernels partition the data (e.g., one chunk per thread
+// for buffers carved in per-team slots). On device builds, this is a deep_copy.
+template<typename ViewT>
+void first_touch_zero (const ViewT& v, const int nchunks) {
+  static_assert (ViewT::rank==1, "Error! first_touch_zero requires a rank-1 view.\n");
+
+  using exec_space = typename ViewT::execution_space;
+  using value_type = typename ViewT::non_const_value_type;
+  constexpr bool host_exec = Kokkos::SpaceAccessibility<exec_space,Kokkos::HostSpace>::accessible;
+
+  const long long size = v.size();
+  if (!host_exec) {
+    Kokkos::deep_copy(v,value_type(0));
+    return;
+  }
+  if (size==0) {
+    return;
+  }
+
+  const int n = std::max(1,static_cast<int>(std::min<long long>(nchunks,size)));
+  Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0,n),
+                       KOKKOS_LAMBDA(const int ichunk) {
+    const long long beg = (size*ichunk)/n;
+    const long long end = (size*(ichunk+1))/n;
+    for (long long i=beg; i<end; ++i) {
+      v(i) = value_type(0);
+    }
+  });
+  Kokkos::fence();
+}
+
 } // namespace Homme
 
 #endif // HOMMEXX_VIEW_UTILS_HPP
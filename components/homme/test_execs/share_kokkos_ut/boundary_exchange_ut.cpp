@@ -302,6 +302,74 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Single precision exchange of 3d fields. Check it against the double precision
+  // exchange of the same data (accuracy), check that the sum of the contributions
+  // is preserved (conservation), and check that a double precision field sharing
+  // the same exchange is not affected.
+  {
+    constexpr double sp_tolerance = 1e-6;
+
+    ExecViewManaged<Scalar*[2][NP][NP][NUM_LEV]> field_dp_cxx("", num_elements);
+    ExecViewManaged<Scalar*[2][NP][NP][NUM_LEV]> field_sp_cxx("", num_elements);
+    ExecViewManaged<Scalar*[NP][NP][NUM_LEV]>    mult_cxx("", num_elements);
+    auto field_in_host = Kokkos::create_mirror_view(field_dp_cxx);
+    auto field_dp_host = Kokkos::create_mirror_view(field_dp_cxx);
+    auto field_sp_host = Kokkos::create_mirror_view(field_sp_cxx);
+    auto mult_host     = Kokkos::create_mirror_view(mult_cxx);
+
+    genRandArray(field_in_host,engine,dreal);
+    Kokkos::deep_copy(field_dp_cxx, field_in_host);
+    Kokkos::deep_copy(field_sp_cxx, field_in_host);
+    Kokkos::deep_copy(mult_cxx, Scalar(1.0));
+
+    auto be_dp = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_dp->set_num_fields(0,0,3);
+    be_dp->register_field(field_dp_cxx,2,0);
+    be_dp->register_field(mult_cxx);
+    be_dp->registration_completed();
+
+    auto be_sp = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_sp->set_num_fields(0,0,2);
+    be_sp->set_single_precision(true);
+    be_sp->register_field(field_sp_cxx,1,0);
+    be_sp->set_single_precision(false);
+    be_sp->register_field(field_sp_cxx,1,1);
+    be_sp->registration_completed();
+
+    be_dp->exchange();
+    be_sp->exchange();
+
+    Kokkos::deep_copy(field_dp_host, field_dp_cxx);
+    Kokkos::deep_copy(field_sp_host, field_sp_cxx);
+    Kokkos::deep_copy(mult_host,     mult_cxx);
+
+    // Local sums of the input contributions, and of the output values divided
+    // by the number of elements sharing each point
+    Real sums[3] = {0, 0, 0};
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
+        const int ilev = level / VECTOR_SIZE;
+        const int ivec = level % VECTOR_SIZE;
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            const Real dp = field_dp_host(ie,0,igp,jgp,ilev)[ivec];
+            const Real sp = field_sp_host(ie,0,igp,jgp,ilev)[ivec];
+            REQUIRE(std::abs(sp-dp) < sp_tolerance);
+            REQUIRE(compare_answers(field_dp_host(ie,1,igp,jgp,ilev)[ivec],
+                                    field_sp_host(ie,1,igp,jgp,ilev)[ivec]) < test_tolerance);
+
+            const Real in = field_in_host(ie,0,igp,jgp,ilev)[ivec];
+            sums[0] += in;
+            sums[1] += std::abs(in);
+            sums[2] += sp / mult_host(ie,igp,jgp,ilev)[ivec];
+    }}}}
+    MPI_Allreduce(MPI_IN_PLACE, sums, 3, MPI_DOUBLE, MPI_SUM, connectivity->get_comm().mpi_comm());
+    REQUIRE(std::abs(sums[2]-sums[0]) < sp_tolerance*sums[1]);
+
+    be_dp->clean_up();
+    be_sp->clean_up();
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
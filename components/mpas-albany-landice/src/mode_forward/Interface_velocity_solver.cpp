@@ -90,6 +90,9 @@ exchangeList_Type const *sendVerticesList_F = 0, *recvVerticesList_F = 0;
 exchangeList_Type sendVerticesListReversed, recvVerticesListReversed,
     sendCellsListReversed, recvCellsListReversed;
 
+// exchange plans built on first use, valid until the exchange lists change
+exchangePlanList_Type exchangePlans;
+
 exchange::exchange(int _procID, int const* vec_first, int const* vec_last,
     int fieldDim) :
     procID(_procID), vec(vec_first, vec_last), buffer(
@@ -181,6 +184,7 @@ void velocity_solver_set_grid_data(int const* _nCells_F, int const* _nEdges_F,
 
   thicknessOnCells.resize(nCellsSolve_F);
 
+  clearExchangePlans();
   sendCellsList_F = new exchangeList_Type(unpackMpiArray(sendCellsArray_F));
   recvCellsList_F = new exchangeList_Type(unpackMpiArray(recvCellsArray_F));
   sendEdgesList_F = new exchangeList_Type(unpackMpiArray(sendEdgesArray_F));
@@ -333,6 +337,7 @@ void velocity_solver_export_fo_velocity() {
 
 void velocity_solver_finalize() {
   velocity_solver_finalize__();
+  clearExchangePlans();
   delete sendCellsList_F;
   delete recvCellsList_F;
   delete sendEdgesList_F;
@@ -358,6 +363,9 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   verticesMask_F = _verticesMask_F;
   dirichletCellsMask_F = _dirichletCellsMask_F;
 
+  // the reversed exchange lists are rebuilt below
+  clearExchangePlans();
+
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
@@ -1009,12 +1017,12 @@ void mapVerticesToCells(const std::vector<double>& velocityOnVertices,
     }
   }
 
-  for (int dim = 0; dim < fieldDim; dim++) {
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        &sendCellsListReversed, &recvCellsListReversed, (numLayers + 1));
-    allToAll(&velocityOnCells[dim * nCells_F * (numLayers + 1)],
-        sendCellsList_F, recvCellsList_F, (numLayers + 1));
-  }
+  // all components are exchanged together, one block of nCells_F columns each
+  int blockStride = nCells_F * (numLayers + 1);
+  allToAll(velocityOnCells, &sendCellsListReversed, &recvCellsListReversed,
+      (numLayers + 1), fieldDim, blockStride);
+  allToAll(velocityOnCells, sendCellsList_F, recvCellsList_F,
+      (numLayers + 1), fieldDim, blockStride);
 }
 
 
@@ -1526,45 +1534,96 @@ void allToAll(std::vector<int>& field, exchangeList_Type const * sendList,
 }
 
 void allToAll(double* field, exchangeList_Type const * sendList,
-    exchangeList_Type const * recvList, int fieldDim) {
-  int me;
-  MPI_Comm_rank(comm, &me);
+    exchangeList_Type const * recvList, int fieldDim, int nBlocks,
+    int blockStride) {
+  getExchangePlan(sendList, recvList, fieldDim, nBlocks, blockStride).run(field);
+}
 
-  for (int iComp = 0; iComp < fieldDim; iComp++) {
-    exchangeList_Type::const_iterator it;
+exchangePlan& getExchangePlan(exchangeList_Type const* sendList,
+    exchangeList_Type const* recvList, int fieldDim, int nBlocks, int blockStride) {
+  exchangePlanList_Type::iterator it;
+  for (it = exchangePlans.begin(); it != exchangePlans.end(); ++it) {
+    if ((it->sendList == sendList) && (it->recvList == recvList)
+        && (it->fieldDim == fieldDim) && (it->nBlocks == nBlocks)
+        && (it->blockStride == blockStride))
+      return *it;
+  }
+  exchangePlans.emplace_back(sendList, recvList, fieldDim, nBlocks, blockStride);
+  return exchangePlans.back();
+}
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Irecv(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, it->procID, comm, &it->reqID);
-    }
+void clearExchangePlans() {
+  exchangePlans.clear();
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      for (ID i = 0; i < it->vec.size(); i++)
-        it->doubleBuffer[i] = field[fieldDim * it->vec[i] + iComp];
+exchangePlan::exchangePlan(exchangeList_Type const* _sendList,
+    exchangeList_Type const* _recvList, int _fieldDim, int _nBlocks,
+    int _blockStride) :
+    sendList(_sendList), recvList(_recvList), fieldDim(_fieldDim),
+    nBlocks(_nBlocks), blockStride(_blockStride) {
+  int me;
+  MPI_Comm_rank(comm, &me);
+  int msgDim = fieldDim * nBlocks;
 
-      MPI_Isend(&(it->doubleBuffer[0]), it->doubleBuffer.size(), MPI_DOUBLE,
-          it->procID, me, comm, &it->reqID);
-    }
+  exchangeList_Type::const_iterator it;
+  for (it = recvList->begin(); it != recvList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    recvs.push_back(&*it);
+    recvBuffers.push_back(std::vector<double>(msgDim * it->vec.size()));
+  }
+  for (it = sendList->begin(); it != sendList->end(); ++it) {
+    if (it->procID == me)
+      continue;
+    sends.push_back(&*it);
+    sendBuffers.push_back(std::vector<double>(msgDim * it->vec.size()));
+  }
 
-    for (it = recvList->begin(); it != recvList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
+  requests.resize(recvs.size() + sends.size());
+  for (int i = 0; i < int(recvs.size()); i++)
+    MPI_Recv_init(recvBuffers[i].data(), recvBuffers[i].size(), MPI_DOUBLE,
+        recvs[i]->procID, recvs[i]->procID, comm, &requests[i]);
+  for (int i = 0; i < int(sends.size()); i++)
+    MPI_Send_init(sendBuffers[i].data(), sendBuffers[i].size(), MPI_DOUBLE,
+        sends[i]->procID, me, comm, &requests[recvs.size() + i]);
+}
 
-      for (int i = 0; i < int(it->vec.size()); i++)
-        field[fieldDim * it->vec[i] + iComp] = it->doubleBuffer[i];
-    }
+exchangePlan::~exchangePlan() {
+  for (int i = 0; i < int(requests.size()); i++)
+    MPI_Request_free(&requests[i]);
+}
 
-    for (it = sendList->begin(); it != sendList->end(); ++it) {
-      if (it->procID == me)
-        continue;
-      MPI_Wait(&it->reqID, MPI_STATUS_IGNORE);
-    }
+void exchangePlan::run(double* field) {
+  int nRecvs = recvs.size();
+  int nSends = sends.size();
+
+  MPI_Startall(nRecvs, requests.data());
+
+  for (int is = 0; is < nSends; is++) {
+    const std::vector<int>& vec = sends[is]->vec;
+    double* buffer = sendBuffers[is].data();
+    int nEntities = vec.size();
+    for (int ib = 0; ib < nBlocks; ib++)
+      for (int i = 0; i < nEntities; i++)
+        for (int iComp = 0; iComp < fieldDim; iComp++)
+          buffer[(ib * nEntities + i) * fieldDim + iComp] =
+              field[ib * blockStride + fieldDim * vec[i] + iComp];
   }
+  MPI_Startall(nSends, requests.data() + nRecvs);
+
+  MPI_Waitall(nRecvs, requests.data(), MPI_STATUSES_IGNORE);
+  for (int ir = 0; ir < nRecvs; ir++) {
+    const std::vector<int>& vec = recvs[ir]->vec;
+    double const* buffer = recvBuffers[ir].data();
+    int nEntities = vec.size();
+    for (int ib = 0; ib < nBlocks; ib++)
+      for (int i = 0; i < nEntities; i++)
+        for (int iComp = 0; iComp < fieldDim; iComp++)
+          field[ib * blockStride + fieldDim * vec[i] + iComp] =
+              buffer[(ib * nEntities + i) * fieldDim + iComp];
+  }
+
+  MPI_Waitall(nSends, requests.data() + nRecvs, MPI_STATUSES_IGNORE);
 }
 
 int initialize_iceProblem(int nTriangles) {
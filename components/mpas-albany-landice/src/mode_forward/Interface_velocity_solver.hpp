@@ -57,6 +57,33 @@ struct exchange {
 
 typedef std::list<exchange> exchangeList_Type;
 
+// Persistent exchange of a double field over a pair of exchange lists.
+// The buffers and the persistent MPI requests are created once, and every
+// component (and every block) of the field travels in a single packed
+// message per neighbor. Plans must be cleared whenever the exchange lists
+// they refer to are rebuilt (see clearExchangePlans).
+struct exchangePlan {
+  exchangeList_Type const * const sendList;
+  exchangeList_Type const * const recvList;
+  const int fieldDim;
+  const int nBlocks;
+  const int blockStride;
+
+  std::vector<exchange const *> sends, recvs;
+  std::vector<std::vector<double> > sendBuffers, recvBuffers;
+  std::vector<MPI_Request> requests; // receives first, then sends
+
+  exchangePlan(exchangeList_Type const* _sendList, exchangeList_Type const* _recvList,
+      int _fieldDim, int _nBlocks, int _blockStride);
+  exchangePlan(const exchangePlan&) = delete;
+  exchangePlan& operator=(const exchangePlan&) = delete;
+  ~exchangePlan();
+
+  void run(double* field);
+};
+
+typedef std::list<exchangePlan> exchangePlanList_Type;
+
 typedef unsigned int ID;
 typedef unsigned int UInt;
 const ID NotAnId = std::numeric_limits<int>::max();
@@ -260,7 +287,13 @@ void allToAll(std::vector<int>& field, exchangeList_Type const* sendList,
     exchangeList_Type const* recvList, int fieldDim = 1);
 
 void allToAll(double* field, exchangeList_Type const* sendList,
-    exchangeList_Type const* recvList, int fieldDim = 1);
+    exchangeList_Type const* recvList, int fieldDim = 1, int nBlocks = 1,
+    int blockStride = 0);
+
+exchangePlan& getExchangePlan(exchangeList_Type const* sendList,
+    exchangeList_Type const* recvList, int fieldDim, int nBlocks, int blockStride);
+
+void clearExchangePlans();
 
 void procsSharingVertex(const int vertex, std::vector<int>& procIds);
 